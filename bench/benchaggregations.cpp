@@ -0,0 +1,200 @@
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/aggregation/tree.hpp>
+#include <dracosha/validator/variadic_property.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+struct BenchTreeNode
+{
+    explicit BenchTreeNode(std::string name) : _name(std::move(name))
+    {}
+
+    const BenchTreeNode& child(size_t index) const
+    {
+        return *_children.at(index);
+    }
+
+    size_t child_count() const noexcept
+    {
+        return _children.size();
+    }
+
+    const std::string& name() const noexcept
+    {
+        return _name;
+    }
+
+    std::vector<std::unique_ptr<BenchTreeNode>> _children;
+    std::string _name;
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(name)
+DRACOSHA_VALIDATOR_PROPERTY(child_count)
+DRACOSHA_VALIDATOR_VARIADIC_PROPERTY(child)
+
+/**
+ * Make tree with the given number of levels where each node has the given number of children.
+ */
+void fill_tree(BenchTreeNode& node, size_t depth, size_t width)
+{
+    if (depth==0)
+    {
+        return;
+    }
+    for (size_t i=0;i<width;i++)
+    {
+        node._children.emplace_back(new BenchTreeNode(node.name()+"."+std::to_string(i)));
+        fill_tree(*node._children.back(),depth-1,width);
+    }
+}
+
+std::map<int,int> make_map(size_t size)
+{
+    std::map<int,int> m;
+    for (size_t i=0;i<size;i++)
+    {
+        m.emplace(static_cast<int>(i),static_cast<int>(i));
+    }
+    return m;
+}
+
+/**
+ * Make configuration of limits where a limit is looked up by a name.
+ */
+std::map<std::string,int> make_config()
+{
+    std::map<std::string,int> config;
+    for (size_t i=0;i<100;i++)
+    {
+        config.emplace("limits.other."+std::to_string(i),static_cast<int>(i));
+    }
+    config.emplace("limits.items.min",0);
+    return config;
+}
+
+}
+
+static void AllVector(benchmark::State& state)
+{
+    auto v=validator(_[ALL](gte,0));
+    std::vector<int> vec(state.range(0),10);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(vec));
+    }
+    state.SetItemsProcessed(state.iterations()*vec.size());
+}
+BENCHMARK(AllVector)->Range(8,65536);
+
+template <typename LazyT>
+void allVectorLazyLimit(benchmark::State& state, LazyT&& limit)
+{
+    auto v=validator(_[ALL](gte,std::forward<LazyT>(limit)));
+    std::vector<int> vec(state.range(0),10);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(vec));
+    }
+    state.SetItemsProcessed(state.iterations()*vec.size());
+}
+
+static void AllVectorLazyLimit(benchmark::State& state)
+{
+    auto config=make_config();
+    allVectorLazyLimit(state,lazy([&config](){return config.at("limits.items.min");}));
+}
+BENCHMARK(AllVectorLazyLimit)->Range(8,65536);
+
+static void AllVectorLazyEachLimit(benchmark::State& state)
+{
+    auto config=make_config();
+    allVectorLazyLimit(state,lazy_each([&config](){return config.at("limits.items.min");}));
+}
+BENCHMARK(AllVectorLazyEachLimit)->Range(8,65536);
+
+static void AnyVector(benchmark::State& state)
+{
+    auto v=validator(_[ANY](lt,0));
+    std::vector<int> vec(state.range(0),10);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(vec));
+    }
+    state.SetItemsProcessed(state.iterations()*vec.size());
+}
+BENCHMARK(AnyVector)->Range(8,65536);
+
+static void AllMap(benchmark::State& state)
+{
+    auto v=validator(_[ALL](gte,0));
+    auto m=make_map(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(m));
+    }
+    state.SetItemsProcessed(state.iterations()*m.size());
+}
+BENCHMARK(AllMap)->Range(8,65536);
+
+static void AnyMap(benchmark::State& state)
+{
+    auto v=validator(_[ANY](lt,0));
+    auto m=make_map(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(m));
+    }
+    state.SetItemsProcessed(state.iterations()*m.size());
+}
+BENCHMARK(AnyMap)->Range(8,65536);
+
+static void AllNestedVector(benchmark::State& state)
+{
+    auto v=validator(_["items"][ALL][ALL](lt,100));
+    std::map<std::string,std::vector<std::vector<int>>> m{
+        {"items",std::vector<std::vector<int>>(state.range(0),std::vector<int>(16,10))}
+    };
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(m));
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0)*16);
+}
+BENCHMARK(AllNestedVector)->Range(8,4096);
+
+static void TreeAll(benchmark::State& state)
+{
+    auto v=validator(
+            _[tree(ALL,child,child_count)][name](gte,"Node")
+         );
+    BenchTreeNode root("Node");
+    fill_tree(root,static_cast<size_t>(state.range(0)),4);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(root));
+    }
+}
+BENCHMARK(TreeAll)->DenseRange(1,6);
+
+static void TreeAny(benchmark::State& state)
+{
+    auto v=validator(
+            _[tree(ANY,child,child_count)][name](eq,"unknown")
+         );
+    BenchTreeNode root("Node");
+    fill_tree(root,static_cast<size_t>(state.range(0)),4);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(root));
+    }
+}
+BENCHMARK(TreeAny)->DenseRange(1,6);
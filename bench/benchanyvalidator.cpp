@@ -0,0 +1,153 @@
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/any_validator.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace
+{
+
+using map_type=std::map<std::string,size_t>;
+using adapter_type=default_adapter<const map_type&>;
+
+constexpr const size_t RulesCount=10000;
+
+const map_type& sample()
+{
+    static map_type m{{"field1",1},{"field2",20}};
+    return m;
+}
+
+auto small_validator(size_t i)
+{
+    return validator(_["field2"](gte,i%20));
+}
+
+auto large_validator(size_t i)
+{
+    return validator(
+                _["field1"](lt,i+2),
+                _["field2"](gte,i%20),
+                _["field2"](ne,i+21),
+                _["field1"](gte,0)
+            );
+}
+
+template <typename FnT>
+void applyRules(benchmark::State& state, const FnT& fn)
+{
+    auto a=make_default_adapter(sample());
+    for (auto _ : state)
+    {
+        size_t passed=fn(a);
+        benchmark::DoNotOptimize(passed);
+    }
+    state.SetItemsProcessed(state.iterations()*RulesCount);
+}
+
+}
+
+static void SharedValidatorRules(benchmark::State& state)
+{
+    std::vector<std::function<status (adapter_type&)>> rules;
+    for (size_t i=0;i<RulesCount;i++)
+    {
+        if (i%2==0)
+        {
+            auto v=shared_validator(small_validator(i));
+            rules.emplace_back([v](adapter_type& a){return v->apply(a);});
+        }
+        else
+        {
+            auto v=shared_validator(large_validator(i));
+            rules.emplace_back([v](adapter_type& a){return v->apply(a);});
+        }
+    }
+    applyRules(state,
+        [&rules](adapter_type& a)
+        {
+            size_t passed=0;
+            for (auto&& rule:rules)
+            {
+                if (rule(a))
+                {
+                    ++passed;
+                }
+            }
+            return passed;
+        }
+    );
+}
+BENCHMARK(SharedValidatorRules);
+
+static void AnyValidatorHeapRules(benchmark::State& state)
+{
+    std::vector<any_validator<adapter_type>> rules;
+    rules.reserve(RulesCount);
+    for (size_t i=0;i<RulesCount;i++)
+    {
+        if (i%2==0)
+        {
+            rules.emplace_back(small_validator(i));
+        }
+        else
+        {
+            rules.emplace_back(large_validator(i));
+        }
+    }
+    applyRules(state,
+        [&rules](adapter_type& a)
+        {
+            size_t passed=0;
+            for (auto&& rule:rules)
+            {
+                if (rule.apply(a))
+                {
+                    ++passed;
+                }
+            }
+            return passed;
+        }
+    );
+}
+BENCHMARK(AnyValidatorHeapRules);
+
+static void AnyValidatorArenaRules(benchmark::State& state)
+{
+    validator_arena arena;
+    std::vector<any_validator<adapter_type>> rules;
+    rules.reserve(RulesCount);
+    for (size_t i=0;i<RulesCount;i++)
+    {
+        if (i%2==0)
+        {
+            rules.emplace_back(small_validator(i),arena);
+        }
+        else
+        {
+            rules.emplace_back(large_validator(i),arena);
+        }
+    }
+    applyRules(state,
+        [&rules](adapter_type& a)
+        {
+            size_t passed=0;
+            for (auto&& rule:rules)
+            {
+                if (rule.apply(a))
+                {
+                    ++passed;
+                }
+            }
+            return passed;
+        }
+    );
+}
+BENCHMARK(AnyValidatorArenaRules);
@@ -0,0 +1,83 @@
+#include <map>
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/adapters/default_adapter.hpp>
+#include <dracosha/validator/filter_path.hpp>
+#include <dracosha/validator/path_trie.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+constexpr const size_t FilterPathsCount=64;
+constexpr const size_t LargeFilterPathsCount=10000;
+
+auto make_filter_validator()
+{
+    return validator(
+                _["field1"](gte,100),
+                _["field20"](gte,100),
+                _["field40"](gte,100),
+                _["field63"](gte,100),
+                _["other"](gte,100)
+            );
+}
+
+std::map<std::string,size_t> make_filter_object()
+{
+    return std::map<std::string,size_t>{
+        {"field1",200},
+        {"field20",200},
+        {"field40",200},
+        {"field63",200},
+        {"other",10}
+    };
+}
+
+template <size_t ...I>
+auto make_filter_path_list(std::index_sequence<I...>)
+{
+    return member_path_list(_[std::string("field")+std::to_string(I)]...);
+}
+
+template <typename PathsT>
+void validateFiltered(benchmark::State& state, const PathsT& paths)
+{
+    auto v=make_filter_validator();
+    auto m=make_filter_object();
+    auto a=include_paths(make_default_adapter(m),paths);
+    for (auto _ : state)
+    {
+        auto ok=v.apply(a);
+        benchmark::DoNotOptimize(ok);
+    }
+}
+
+}
+
+static void FilterPathList(benchmark::State& state)
+{
+    validateFiltered(state,make_filter_path_list(std::make_index_sequence<FilterPathsCount>{}));
+}
+BENCHMARK(FilterPathList);
+
+static void FilterPathTrie(benchmark::State& state)
+{
+    validateFiltered(state,path_trie(make_filter_path_list(std::make_index_sequence<FilterPathsCount>{})));
+}
+BENCHMARK(FilterPathTrie);
+
+static void FilterLargePathTrie(benchmark::State& state)
+{
+    path_trie trie;
+    for (size_t i=0;i<LargeFilterPathsCount;i++)
+    {
+        trie.add(_[std::string("field")+std::to_string(i)]);
+    }
+    validateFiltered(state,trie);
+}
+BENCHMARK(FilterLargePathTrie);
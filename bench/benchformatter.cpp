@@ -0,0 +1,41 @@
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/detail/formatter_std.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+static void StdAppendReport(benchmark::State& state)
+{
+    auto count=static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::string dst;
+        auto f=detail::std_backend_formatter{dst};
+        for (size_t i=0;i<count;i++)
+        {
+            f.append("element ",i," must be less than ",100);
+            f.append(", ");
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(StdAppendReport)->RangeMultiplier(10)->Range(100,100000)->Complexity(benchmark::oN);
+
+static void StdAppendJoin(benchmark::State& state)
+{
+    auto count=static_cast<size_t>(state.range(0));
+    std::vector<std::string> parts(count,"element must be less than 100");
+    for (auto _ : state)
+    {
+        std::string dst;
+        auto f=detail::std_backend_formatter{dst};
+        f.append_join(", ",parts);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(StdAppendJoin)->RangeMultiplier(10)->Range(100,100000)->Complexity(benchmark::oN);
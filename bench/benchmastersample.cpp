@@ -0,0 +1,97 @@
+#include <map>
+#include <vector>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+using record_type=std::map<std::string,std::map<std::string,int>>;
+
+constexpr const size_t RecordsCount=1000000;
+constexpr const size_t DistinctRecordsCount=1024;
+
+/**
+ * Make golden template with a number of sections each containing a number of fields.
+ */
+record_type make_sample()
+{
+    record_type sample;
+    for (size_t i=0;i<16;i++)
+    {
+        auto& section=sample["section_"+std::to_string(i)];
+        for (size_t j=0;j<16;j++)
+        {
+            section.emplace("field_"+std::to_string(j),static_cast<int>(i*16+j));
+        }
+    }
+    return sample;
+}
+
+/**
+ * Make records that differ from the golden template in some fields.
+ */
+std::vector<record_type> make_records(const record_type& sample)
+{
+    std::vector<record_type> records(DistinctRecordsCount,sample);
+    for (size_t i=0;i<records.size();i++)
+    {
+        records[i]["section_15"]["field_15"]=static_cast<int>(i);
+    }
+    return records;
+}
+
+template <typename SampleT>
+auto make_records_validator(const SampleT& s)
+{
+    return validator(
+                _["section_1"]["field_1"](eq,s),
+                _["section_3"]["field_5"](eq,s),
+                _["section_7"]["field_7"](gte,s),
+                _["section_9"]["field_10"](eq,s),
+                _["section_12"]["field_3"](lte,s),
+                _["section_14"]["field_12"](eq,s),
+                _["section_15"]["field_0"](eq,s),
+                _["section_15"]["field_15"](gte,s)
+            );
+}
+
+template <typename SampleT>
+void validateRecords(benchmark::State& state, const SampleT& s)
+{
+    auto records=make_records(s());
+    auto v=make_records_validator(s);
+    for (auto _ : state)
+    {
+        size_t passed=0;
+        for (size_t i=0;i<RecordsCount;i++)
+        {
+            if (v.apply(records[i%records.size()]))
+            {
+                ++passed;
+            }
+        }
+        benchmark::DoNotOptimize(passed);
+    }
+    state.SetItemsProcessed(state.iterations()*RecordsCount);
+}
+
+}
+
+static void MasterSampleRecords(benchmark::State& state)
+{
+    auto sample=make_sample();
+    validateRecords(state,_(sample));
+}
+BENCHMARK(MasterSampleRecords)->Unit(benchmark::kMillisecond);
+
+static void IndexedMasterSampleRecords(benchmark::State& state)
+{
+    auto sample=make_sample();
+    validateRecords(state,indexed_sample(sample));
+}
+BENCHMARK(IndexedMasterSampleRecords)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,177 @@
+#include <map>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/compile.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+struct BenchObject
+{
+    int field1=100;
+    std::string field2="value of field2";
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(field1)
+DRACOSHA_VALIDATOR_PROPERTY(field2)
+
+using nested_map=std::map<std::string,std::map<std::string,std::map<std::string,int>>>;
+
+nested_map make_nested_map()
+{
+    return nested_map{
+        {"level1",{{"level2",{{"level3",100},{"other",200}}}}},
+        {"other",{}}
+    };
+}
+
+template <typename ValidatorT, typename ObjectT>
+void bench_apply(benchmark::State& state, const ValidatorT& v, ObjectT& obj)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(obj));
+    }
+}
+
+}
+
+static void ScalarValue(benchmark::State& state)
+{
+    auto v=validator(value(gt,10) ^AND^ value(lt,1000));
+    int val=100;
+    bench_apply(state,v,val);
+}
+BENCHMARK(ScalarValue);
+
+static void ScalarMember(benchmark::State& state)
+{
+    auto v=validator(
+                _["field1"](gt,10),
+                _["field2"](lt,1000)
+            );
+    std::map<std::string,int> m{{"field1",100},{"field2",200}};
+    bench_apply(state,v,m);
+}
+BENCHMARK(ScalarMember);
+
+static void ScalarProperty(benchmark::State& state)
+{
+    auto v=validator(
+                _[field1](gt,10),
+                _[field2](size(gte,8))
+            );
+    BenchObject obj;
+    bench_apply(state,v,obj);
+}
+BENCHMARK(ScalarProperty);
+
+static void NestedMember(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](eq,100)
+            );
+    auto m=make_nested_map();
+    bench_apply(state,v,m);
+}
+BENCHMARK(NestedMember);
+
+static void NestedMemberCheckExists(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](eq,100),
+                _["level1"]["level2"]["unknown"](gt,0)
+            );
+    auto m=make_nested_map();
+    auto a=make_default_adapter(m);
+    a.set_check_member_exists_before_validation(true);
+    bench_apply(state,v,a);
+}
+BENCHMARK(NestedMemberCheckExists);
+
+static void SameNestedMember(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](gte,10),
+                _["level1"]["level2"]["level3"](lte,1000),
+                _["level1"]["level2"]["level3"](ne,500)
+            );
+    auto m=make_nested_map();
+    auto a=make_default_adapter(m);
+    a.set_check_member_exists_before_validation(true);
+    bench_apply(state,v,a);
+}
+BENCHMARK(SameNestedMember);
+
+static void SameNestedMemberCompiled(benchmark::State& state)
+{
+    auto v=compile(
+                validator(
+                    _["level1"]["level2"]["level3"](gte,10),
+                    _["level1"]["level2"]["level3"](lte,1000),
+                    _["level1"]["level2"]["level3"](ne,500)
+                )
+            );
+    auto m=make_nested_map();
+    auto a=make_default_adapter(m);
+    a.set_check_member_exists_before_validation(true);
+    bench_apply(state,v,a);
+}
+BENCHMARK(SameNestedMemberCompiled);
+
+static void DefaultAdapterOk(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](gte,10),
+                _["level1"]["level2"]["other"](lt,1000)
+            );
+    auto m=make_nested_map();
+    bench_apply(state,v,m);
+}
+BENCHMARK(DefaultAdapterOk);
+
+static void ReportingAdapterOk(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](gte,10),
+                _["level1"]["level2"]["other"](lt,1000)
+            );
+    auto m=make_nested_map();
+    std::string report;
+    auto a=make_reporting_adapter(m,report);
+    bench_apply(state,v,a);
+}
+BENCHMARK(ReportingAdapterOk);
+
+static void DefaultAdapterFail(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](gte,10),
+                _["level1"]["level2"]["other"](lt,100)
+            );
+    auto m=make_nested_map();
+    bench_apply(state,v,m);
+}
+BENCHMARK(DefaultAdapterFail);
+
+static void ReportingAdapterFail(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["level2"]["level3"](gte,10),
+                _["level1"]["level2"]["other"](lt,100)
+            );
+    auto m=make_nested_map();
+    std::string report;
+    for (auto _ : state)
+    {
+        report.clear();
+        auto a=make_reporting_adapter(m,report);
+        benchmark::DoNotOptimize(v.apply(a));
+    }
+}
+BENCHMARK(ReportingAdapterFail);
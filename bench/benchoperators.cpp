@@ -0,0 +1,172 @@
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/operators/in.hpp>
+#include <dracosha/validator/operators/lex_in.hpp>
+#include <dracosha/validator/operators/lexicographical.hpp>
+#include <dracosha/validator/operators/regex.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+std::vector<int> make_ints(size_t size)
+{
+    std::vector<int> vec;
+    vec.reserve(size);
+    for (size_t i=0;i<size;i++)
+    {
+        vec.push_back(static_cast<int>(i*2));
+    }
+    return vec;
+}
+
+std::vector<std::string> make_strings(size_t size)
+{
+    std::vector<std::string> vec;
+    vec.reserve(size);
+    for (size_t i=0;i<size;i++)
+    {
+        vec.push_back("value_"+std::to_string(100000+i));
+    }
+    return vec;
+}
+
+template <typename ValidatorT, typename T>
+void bench_value(benchmark::State& state, const ValidatorT& v, const T& val)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v.apply(val));
+    }
+}
+
+}
+
+static void InPlainRange(benchmark::State& state)
+{
+    auto v=validator(in,range(make_ints(state.range(0))));
+    bench_value(state,v,static_cast<int>(state.range(0)));
+}
+BENCHMARK(InPlainRange)->Range(8,4096);
+
+static void InSortedRange(benchmark::State& state)
+{
+    auto v=validator(in,range(make_ints(state.range(0)),sorted));
+    bench_value(state,v,static_cast<int>(state.range(0)));
+}
+BENCHMARK(InSortedRange)->Range(8,4096);
+
+static void InHashedRange(benchmark::State& state)
+{
+    auto v=validator(in,range(make_ints(state.range(0)),hashed));
+    bench_value(state,v,static_cast<int>(state.range(0)));
+}
+BENCHMARK(InHashedRange)->Range(8,4096);
+
+static void InInterval(benchmark::State& state)
+{
+    auto v=validator(in,interval(0,1000));
+    bench_value(state,v,500);
+}
+BENCHMARK(InInterval);
+
+static void LexInPlainRange(benchmark::State& state)
+{
+    auto strings=make_strings(state.range(0));
+    auto v=validator(lex_in,range(strings));
+    bench_value(state,v,strings.back());
+}
+BENCHMARK(LexInPlainRange)->Range(8,4096);
+
+static void LexInHashedRange(benchmark::State& state)
+{
+    auto strings=make_strings(state.range(0));
+    auto v=validator(lex_in,range(strings,hashed));
+    bench_value(state,v,strings.back());
+}
+BENCHMARK(LexInHashedRange)->Range(8,4096);
+
+static void ILexInPlainRange(benchmark::State& state)
+{
+    auto strings=make_strings(state.range(0));
+    auto v=validator(ilex_in,range(strings));
+    bench_value(state,v,std::string("VALUE_")+std::to_string(100000+state.range(0)-1));
+}
+BENCHMARK(ILexInPlainRange)->Range(8,4096);
+
+static void LexEq(benchmark::State& state)
+{
+    std::string str(state.range(0),'a');
+    auto v=validator(lex_eq,str);
+    bench_value(state,v,str);
+}
+BENCHMARK(LexEq)->Arg(8)->Arg(64)->Arg(4096);
+
+static void LexLte(benchmark::State& state)
+{
+    std::string str(state.range(0),'a');
+    auto v=validator(lex_lte,std::string(state.range(0),'a'));
+    bench_value(state,v,str);
+}
+BENCHMARK(LexLte)->Arg(8)->Arg(64)->Arg(4096);
+
+static void LexInInterval(benchmark::State& state)
+{
+    // endpoints and value have common prefix
+    std::string prefix(state.range(0),'p');
+    auto v=validator(lex_in,interval(prefix+"a",prefix+"z"));
+    bench_value(state,v,prefix+"m");
+}
+BENCHMARK(LexInInterval)->Arg(8)->Arg(64)->Arg(4096);
+
+static void ILexEq(benchmark::State& state)
+{
+    std::string str(state.range(0),'a');
+    auto v=validator(ilex_eq,std::string(state.range(0),'A'));
+    bench_value(state,v,str);
+}
+BENCHMARK(ILexEq)->Arg(8)->Arg(64)->Arg(4096);
+
+static void ILexLt(benchmark::State& state)
+{
+    std::string str(state.range(0),'a');
+    auto v=validator(ilex_lt,std::string(state.range(0),'B'));
+    bench_value(state,v,str);
+}
+BENCHMARK(ILexLt)->Arg(8)->Arg(64)->Arg(4096);
+
+static void ILexContains(benchmark::State& state)
+{
+    std::string str(state.range(0),'a');
+    str+="Needle";
+    auto v=validator(ilex_contains,"NEEDLE");
+    bench_value(state,v,str);
+}
+BENCHMARK(ILexContains)->Arg(8)->Arg(64)->Arg(4096);
+
+static void ILexInHashedRange(benchmark::State& state)
+{
+    auto strings=make_strings(state.range(0));
+    auto v=validator(ilex_in,range(strings,hashed));
+    bench_value(state,v,std::string("VALUE_")+std::to_string(100000+state.range(0)-1));
+}
+BENCHMARK(ILexInHashedRange)->Range(8,4096);
+
+static void RegexMatchString(benchmark::State& state)
+{
+    auto v=validator(regex_match,"[a-z_]+[0-9]+");
+    bench_value(state,v,std::string("value_100000"));
+}
+BENCHMARK(RegexMatchString);
+
+static void RegexMatchCompiled(benchmark::State& state)
+{
+    auto v=validator(regex_match,std::regex("[a-z_]+[0-9]+"));
+    bench_value(state,v,std::string("value_100000"));
+}
+BENCHMARK(RegexMatchCompiled);
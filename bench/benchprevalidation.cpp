@@ -0,0 +1,280 @@
+#include <map>
+#include <vector>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/prevalidation/set_validated.hpp>
+#include <dracosha/validator/prevalidation/set_validated_batch.hpp>
+#include <dracosha/validator/prevalidation/resize_validated.hpp>
+#include <dracosha/validator/prevalidation/validate_value.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+static void SetValidatedOk(benchmark::State& state)
+{
+    auto v=validator(
+                _["field1"](gte,100),
+                _["field2"](lt,1000)
+            );
+    std::map<std::string,size_t> m{{"field1",200},{"field2",300}};
+    error_report err;
+    auto field1=_["field1"];
+    size_t val=100;
+    for (auto _ : state)
+    {
+        set_validated(m,field1,val++,v,err);
+        benchmark::DoNotOptimize(err);
+    }
+}
+BENCHMARK(SetValidatedOk);
+
+static void SetValidatedFail(benchmark::State& state)
+{
+    auto v=validator(
+                _["field1"](gte,100),
+                _["field2"](lt,1000)
+            );
+    std::map<std::string,size_t> m{{"field1",200},{"field2",300}};
+    error_report err;
+    auto field1=_["field1"];
+    for (auto _ : state)
+    {
+        set_validated(m,field1,50,v,err);
+        benchmark::DoNotOptimize(err);
+    }
+}
+BENCHMARK(SetValidatedFail);
+
+static void SetValidatedNested(benchmark::State& state)
+{
+    auto v=validator(
+                _["level1"]["field1"](gte,100),
+                _["level1"]["field2"](lt,1000),
+                _["level2"](size(lt,10))
+            );
+    std::map<std::string,std::map<std::string,size_t>> m{
+        {"level1",{{"field1",200},{"field2",300}}},
+        {"level2",{}}
+    };
+    error_report err;
+    auto field1=_["level1"]["field1"];
+    size_t val=100;
+    for (auto _ : state)
+    {
+        set_validated(m,field1,val++,v,err);
+        benchmark::DoNotOptimize(err);
+    }
+}
+BENCHMARK(SetValidatedNested);
+
+static void SetUnvalidated(benchmark::State& state)
+{
+    std::map<std::string,size_t> m{{"field1",200},{"field2",300}};
+    size_t val=100;
+    for (auto _ : state)
+    {
+        m["field1"]=val++;
+        benchmark::DoNotOptimize(m);
+    }
+}
+BENCHMARK(SetUnvalidated);
+
+namespace {
+
+auto make_many_members_validator()
+{
+    return validator(
+                _["field1"](size(lte,100)),
+                _["field2"](size(lte,100)),
+                _["field3"](size(lte,100)),
+                _["field4"](size(lte,100)),
+                _["field5"](size(lte,100)),
+                _["field6"](size(lte,100)),
+                _["field7"](size(lte,100)),
+                _["field8"](size(lte,100)),
+                _["field9"](size(lte,100)),
+                _["field10"](size(lte,100)),
+                _["field11"](size(lte,100)),
+                _["field12"](size(lte,100)),
+                _["field13"](size(lte,100)),
+                _["field14"](size(lte,100)),
+                _["field15"](size(lte,100)),
+                _["field16"](empty(flag,false) ^AND^ size(lte,100) ^AND^ value(lex_starts_with,"value"))
+            );
+}
+
+std::map<std::string,std::string> make_many_members_object()
+{
+    std::map<std::string,std::string> m;
+    for (size_t i=1;i<=16;i++)
+    {
+        m.emplace("field"+std::to_string(i),"value"+std::to_string(i));
+    }
+    return m;
+}
+
+}
+
+static void ResizeValidatedManyMembersThreePass(benchmark::State& state)
+{
+    auto v=make_many_members_validator();
+    auto m=make_many_members_object();
+    error_report err;
+    auto field=_["field16"];
+    size_t val=10;
+    for (auto _ : state)
+    {
+        // implications are validated one by one as it was done before single pass prevalidation
+        validate(field[size],val,v,err);
+        if (!err)
+        {
+            validate(field[empty],val==0,v,err);
+            if (!err)
+            {
+                validate_value(field,true_if_size{val},v,err);
+                if (!err)
+                {
+                    resize_member(m,field,val);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(err);
+        val=(val==10)?20:10;
+    }
+}
+BENCHMARK(ResizeValidatedManyMembersThreePass);
+
+static void ResizeValidatedManyMembers(benchmark::State& state)
+{
+    auto v=make_many_members_validator();
+    auto m=make_many_members_object();
+    error_report err;
+    auto field=_["field16"];
+    size_t val=10;
+    for (auto _ : state)
+    {
+        resize_validated(m,field,val,v,err);
+        benchmark::DoNotOptimize(err);
+        val=(val==10)?20:10;
+    }
+}
+BENCHMARK(ResizeValidatedManyMembers);
+
+namespace {
+
+constexpr const size_t ImportFieldsCount=32;
+
+auto make_import_validator()
+{
+    return validator(
+                _[ALL](gte,100),
+                _["field0"](lt,1000000),
+                _["field8"](lt,1000000),
+                _["field16"](lt,1000000),
+                _["field24"](lt,1000000)
+            );
+}
+
+std::map<std::string,size_t> make_import_object()
+{
+    std::map<std::string,size_t> m;
+    for (size_t i=0;i<ImportFieldsCount;i++)
+    {
+        m.emplace("field"+std::to_string(i),100);
+    }
+    return m;
+}
+
+}
+
+static void ImportSetValidated(benchmark::State& state)
+{
+    auto v=make_import_validator();
+    auto m=make_import_object();
+    std::vector<decltype(_[std::string()])> keys;
+    for (const auto& it : m)
+    {
+        keys.push_back(_[std::string(it.first)]);
+    }
+    error_report err;
+    size_t val=100;
+    for (auto _ : state)
+    {
+        for (const auto& key : keys)
+        {
+            set_validated(m,key,val,v,err);
+            if (err)
+            {
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(err);
+        val=(val==100)?200:100;
+    }
+    state.SetItemsProcessed(state.iterations()*keys.size());
+}
+BENCHMARK(ImportSetValidated);
+
+static void ImportSetValidatedBatch(benchmark::State& state)
+{
+    auto v=make_import_validator();
+    auto m=make_import_object();
+    std::vector<decltype(make_member_edit(_[std::string()],size_t()))> edits;
+    for (const auto& it : m)
+    {
+        edits.push_back(make_member_edit(_[std::string(it.first)],size_t(100)));
+    }
+    error_report err;
+    size_t val=100;
+    for (auto _ : state)
+    {
+        for (auto& edit : edits)
+        {
+            edit.value=val;
+        }
+        set_validated_batch(m,edits,v,err);
+        benchmark::DoNotOptimize(err);
+        val=(val==100)?200:100;
+    }
+    state.SetItemsProcessed(state.iterations()*edits.size());
+}
+BENCHMARK(ImportSetValidatedBatch);
+
+static void ImportSetValidatedBatchManyChecks(benchmark::State& state)
+{
+    auto v=validator(
+                _["field0"](lt,1000000),
+                _["field16"](lt,1000000),
+                _["field32"](lt,1000000),
+                _["field48"](lt,1000000),
+                _["field64"](lt,1000000),
+                _["field80"](lt,1000000),
+                _["field96"](lt,1000000),
+                _["field112"](lt,1000000),
+                _["field128"](lt,1000000),
+                _["field144"](lt,1000000),
+                _["field160"](lt,1000000),
+                _["field176"](lt,1000000),
+                _["field192"](lt,1000000),
+                _["field208"](lt,1000000),
+                _["field224"](lt,1000000),
+                _["field240"](lt,1000000)
+            );
+    std::map<std::string,size_t> m;
+    std::vector<decltype(make_member_edit(_[std::string()],size_t()))> edits;
+    for (size_t i=0;i<8*ImportFieldsCount;i++)
+    {
+        m.emplace("field"+std::to_string(i),100);
+        edits.push_back(make_member_edit(_["field"+std::to_string(i)],size_t(100)));
+    }
+    error_report err;
+    for (auto _ : state)
+    {
+        set_validated_batch(m,edits,v,err);
+        benchmark::DoNotOptimize(err);
+    }
+    state.SetItemsProcessed(state.iterations()*edits.size());
+}
+BENCHMARK(ImportSetValidatedBatchManyChecks);
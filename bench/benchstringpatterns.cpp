@@ -0,0 +1,109 @@
+#include <regex>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/operators/string_patterns.hpp>
+#include <dracosha/validator/operators/number_patterns.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+std::string make_string(size_t len, const std::string& alphabet)
+{
+    std::string str;
+    str.reserve(len);
+    for (size_t i=0;i<len;i++)
+    {
+        str.push_back(alphabet[(i*7)%alphabet.size()]);
+    }
+    return str;
+}
+
+std::string make_float(size_t len)
+{
+    auto digits=make_string(len,"0123456789");
+    digits[len/2]='.';
+    return "-"+digits+"e+10";
+}
+
+template <typename OpT>
+void bench_operator(benchmark::State& state, const OpT& op, const std::string& str)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(op(str,true));
+    }
+    state.SetBytesProcessed(state.iterations()*str.size());
+}
+
+void bench_regex(benchmark::State& state, const std::regex& rx, const std::string& str)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::regex_match(str,rx));
+    }
+    state.SetBytesProcessed(state.iterations()*str.size());
+}
+
+const std::string alpha_chars="abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+const std::string hex_chars="0123456789abcdefABCDEF";
+
+}
+
+static void StrAlpha(benchmark::State& state)
+{
+    bench_operator(state,str_alpha,make_string(state.range(0),alpha_chars));
+}
+static void StrAlphaRegex(benchmark::State& state)
+{
+    static const std::regex rx("[0-9a-zA-Z_]*");
+    bench_regex(state,rx,make_string(state.range(0),alpha_chars));
+}
+BENCHMARK(StrAlpha)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK(StrAlphaRegex)->Arg(8)->Arg(64)->Arg(4096);
+
+static void StrHex(benchmark::State& state)
+{
+    bench_operator(state,str_hex,make_string(state.range(0),hex_chars));
+}
+static void StrHexRegex(benchmark::State& state)
+{
+    static const std::regex rx("[0-9a-fA-F]+");
+    bench_regex(state,rx,make_string(state.range(0),hex_chars));
+}
+BENCHMARK(StrHex)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK(StrHexRegex)->Arg(8)->Arg(64)->Arg(4096);
+
+static void StrInt(benchmark::State& state)
+{
+    bench_operator(state,str_int,"-"+make_string(state.range(0),"0123456789"));
+}
+static void StrIntStrtol(benchmark::State& state)
+{
+    auto str="-"+make_string(state.range(0),"0123456789");
+    for (auto _ : state)
+    {
+        char* p=nullptr;
+        strtol(str.c_str(),&p,10);
+        benchmark::DoNotOptimize(*p==0);
+    }
+    state.SetBytesProcessed(state.iterations()*str.size());
+}
+BENCHMARK(StrInt)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK(StrIntStrtol)->Arg(8)->Arg(64)->Arg(4096);
+
+static void StrFloat(benchmark::State& state)
+{
+    bench_operator(state,str_float,make_float(state.range(0)));
+}
+static void StrFloatRegex(benchmark::State& state)
+{
+    static const std::regex rx("[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?");
+    bench_regex(state,rx,make_float(state.range(0)));
+}
+BENCHMARK(StrFloat)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK(StrFloatRegex)->Arg(8)->Arg(64)->Arg(4096);
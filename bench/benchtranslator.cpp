@@ -0,0 +1,99 @@
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+#include <dracosha/validator/reporting/frozen_translator.hpp>
+#include <dracosha/validator/reporting/extend_translator.hpp>
+#include <dracosha/validator/reporting/locale/ru.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+template <typename TranslatorT>
+void translateAll(benchmark::State& state, const TranslatorT& tr)
+{
+    std::vector<std::string> ids;
+    for (auto&& it:validator_translator_ru().phrases())
+    {
+        ids.push_back(it.first);
+    }
+    auto cats=grammar_categories_bitmask(grammar_ru::zhensky_rod,grammar_ru::roditelny_padezh);
+    for (auto _ : state)
+    {
+        for (auto&& id:ids)
+        {
+            benchmark::DoNotOptimize(tr(id,cats));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()*ids.size()));
+}
+
+template <typename TranslatorT>
+void reportRu(benchmark::State& state, const TranslatorT& sys_tr)
+{
+    std::map<std::string,std::string> m1={{"field1","value1"},{"field2","value2"}};
+    auto v=validator(
+        _["field1"](size(gte,100)) ^OR^ _["field1"](empty(flag,true)),
+        _["field2"](length(lt,3))
+    );
+    mapped_translator names(std::map<std::string,std::string>{{"field1","поле 1"},{"field2","поле 2"}});
+    frozen_translator frozen_names(names);
+    auto tr=extend_translator(sys_tr,frozen_names);
+    auto formatter=make_formatter(tr);
+    for (auto _ : state)
+    {
+        std::string rep;
+        v.apply(make_reporting_adapter(m1,make_reporter(rep,formatter)));
+        benchmark::DoNotOptimize(rep.data());
+    }
+}
+
+}
+
+static void PhraseTranslatorLookup(benchmark::State& state)
+{
+    translateAll(state,validator_translator_ru());
+}
+BENCHMARK(PhraseTranslatorLookup);
+
+static void FrozenTranslatorLookup(benchmark::State& state)
+{
+    translateAll(state,validator_frozen_translator_ru());
+}
+BENCHMARK(FrozenTranslatorLookup);
+
+static void FrozenTranslatorLookupView(benchmark::State& state)
+{
+    const auto& tr=validator_frozen_translator_ru();
+    std::vector<std::string> ids;
+    for (auto&& it:validator_translator_ru().phrases())
+    {
+        ids.push_back(it.first);
+    }
+    auto cats=grammar_categories_bitmask(grammar_ru::zhensky_rod,grammar_ru::roditelny_padezh);
+    for (auto _ : state)
+    {
+        for (auto&& id:ids)
+        {
+            benchmark::DoNotOptimize(tr.lookup(id,cats));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()*ids.size()));
+}
+BENCHMARK(FrozenTranslatorLookupView);
+
+static void PhraseTranslatorReportRu(benchmark::State& state)
+{
+    reportRu(state,validator_translator_ru());
+}
+BENCHMARK(PhraseTranslatorReportRu);
+
+static void FrozenTranslatorReportRu(benchmark::State& state)
+{
+    reportRu(state,validator_frozen_translator_ru());
+}
+BENCHMARK(FrozenTranslatorReportRu);
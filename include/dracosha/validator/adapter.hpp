@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/embedded_object.hpp>
 #include <dracosha/validator/apply.hpp>
 #include <dracosha/validator/adapters/make_intermediate_adapter.hpp>
+#include <dracosha/validator/adapters/impl/failure_collector.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -63,10 +64,10 @@ struct adapter_traits
     static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT&& member, OpsT&& ops)
     {
         auto tmp_adapter=make_intermediate_adapter(adapter,member.path());
-        return while_each(
-                  ops,
+        return while_each_collect_failures(
+                  tmp_adapter,
                   pred,
-                  status(status::code::ignore),
+                  ops,
                   [&member,&tmp_adapter](auto&& op)
                   {
                     return status(
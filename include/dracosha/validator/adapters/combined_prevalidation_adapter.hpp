@@ -0,0 +1,148 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/combined_prevalidation_adapter.hpp
+*
+*  Defines adapter for prevalidation of a number of member implications in a single pass with reporting.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_COMBINED_PREVALIDATION_ADAPTER_HPP
+#define DRACOSHA_VALIDATOR_COMBINED_PREVALIDATION_ADAPTER_HPP
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/adapter.hpp>
+#include <dracosha/validator/with_check_member_exists.hpp>
+#include <dracosha/validator/reporting/reporter.hpp>
+#include <dracosha/validator/reporting/reporting_adapter_impl.hpp>
+#include <dracosha/validator/prevalidation/combined_prevalidation_adapter_impl.hpp>
+#include <dracosha/validator/prevalidation/prevalidation_adapter_tag.hpp>
+#include <dracosha/validator/prevalidation/strict_any.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Traits of combined prevalidation adapter.
+ */
+template <typename ImplicationsT, typename ReporterT>
+class combined_prevalidation_adapter_traits : public adapter_traits,
+                                              public reporting_adapter_impl<ReporterT,combined_prevalidation_adapter_impl<ImplicationsT>>,
+                                              public with_check_member_exists<combined_prevalidation_adapter_traits<ImplicationsT,ReporterT>>
+{
+    public:
+
+        using hana_tag=prevalidation_adapter_tag;
+
+        using expand_aggregation_members=std::integral_constant<bool,false>;
+        using filter_if_not_exists=std::integral_constant<bool,false>;
+
+        /**
+         * @brief Constructor
+         * @param implications Implications to validate.
+         * @param reporter Reporter to use for report construction if validation fails
+         */
+        combined_prevalidation_adapter_traits(
+                    ImplicationsT&& implications,
+                    ReporterT&& reporter
+                ) : reporting_adapter_impl<ReporterT,combined_prevalidation_adapter_impl<ImplicationsT>>(
+                        std::forward<ReporterT>(reporter),
+                        std::forward<ImplicationsT>(implications)
+                    ),
+                    with_check_member_exists<combined_prevalidation_adapter_traits<ImplicationsT,ReporterT>>(*this)
+        {
+            this->set_check_member_exists_before_validation(true);
+        }
+
+        /**
+         * @brief Get value of the first implication.
+         */
+        const auto& get() const
+        {
+            return this->next_adapter_impl().value();
+        }
+
+        template <typename PredicateT, typename AdapterT, typename OpsT, typename MemberT1>
+        static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT1&& member, OpsT&& ops)
+        {
+            return combined_prevalidation_adapter_impl<ImplicationsT>::validate_member_aggregation(
+                            pred,
+                            std::forward<AdapterT>(adapter),
+                            std::forward<MemberT1>(member),
+                            std::forward<OpsT>(ops)
+                        );
+        }
+};
+
+/**
+ * @brief Prevalidation adapter to validate a number of implications of member modification in a single pass.
+ *
+ * Adapter is used when modification of a member affects a few other members, e.g. resizing of a container changes
+ * both its size and emptiness as well as its elements. All implications are checked during one traversal of the validator.
+ */
+template <typename ImplicationsT, typename ReporterT>
+class combined_prevalidation_adapter : public adapter<combined_prevalidation_adapter_traits<ImplicationsT,ReporterT>>
+{
+    public:
+
+        using reporter_type=ReporterT;
+
+        using adapter<combined_prevalidation_adapter_traits<ImplicationsT,ReporterT>>::adapter;
+};
+
+/**
+ * @brief Create combined prevalidation adapter.
+ * @param implications Tuple of implications made with make_prevalidation_implication().
+ * @param reporter Reporter to use for report construction if validation fails.
+ * @param strict Enable strict ANY validation.
+ */
+template <typename ImplicationsT, typename ReporterT>
+auto make_combined_prevalidation_adapter(
+                            ImplicationsT&& implications,
+                            ReporterT&& reporter,
+                            bool strict=false,
+                            std::enable_if_t<
+                                    hana::is_a<reporter_tag,ReporterT>,
+                                    void*>
+                            =nullptr)
+{
+    auto adapter=combined_prevalidation_adapter<ImplicationsT,ReporterT>(std::forward<ImplicationsT>(implications),std::forward<ReporterT>(reporter));
+    traits_of(adapter).next_adapter_impl().set_strict_any(strict);
+    return adapter;
+}
+
+/**
+ * @brief Create combined prevalidation adapter with default reporter.
+ * @param implications Tuple of implications made with make_prevalidation_implication().
+ * @param dst Destination object where to put validation report if validation fails.
+ * @param strict Enable strict ANY validation.
+ */
+template <typename ImplicationsT, typename DstT>
+auto make_combined_prevalidation_adapter(
+                            ImplicationsT&& implications,
+                            DstT& dst,
+                            bool strict=false,
+                            std::enable_if_t<
+                                    !hana::is_a<reporter_tag,DstT>,
+                                    void*>
+                            =nullptr)
+{
+    return make_combined_prevalidation_adapter(std::forward<ImplicationsT>(implications),make_reporter(dst),strict);
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_COMBINED_PREVALIDATION_ADAPTER_HPP
@@ -25,6 +25,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/with_check_member_exists.hpp>
 #include <dracosha/validator/adapter.hpp>
 #include <dracosha/validator/adapters/impl/default_adapter_impl.hpp>
+#include <dracosha/validator/adapters/impl/member_lookup_cache.hpp>
+#include <dracosha/validator/adapters/impl/failure_collector.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -36,7 +38,9 @@ DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 template <typename T>
 class default_adapter_traits :  public adapter_traits,
                                 public with_check_member_exists<default_adapter_traits<T>>,
-                                public default_adapter_impl
+                                public default_adapter_impl,
+                                public member_lookup_cache,
+                                public failure_collector
 {
     public:
 
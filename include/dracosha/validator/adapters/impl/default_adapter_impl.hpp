@@ -30,6 +30,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/utils/conditional_fold.hpp>
 #include <dracosha/validator/operators/exists.hpp>
 #include <dracosha/validator/embedded_object.hpp>
+#include <dracosha/validator/indexed_master_sample.hpp>
+#include <dracosha/validator/adapters/impl/member_lookup_cache.hpp>
+#include <dracosha/validator/adapters/impl/failure_collector.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -129,28 +132,35 @@ struct default_adapter_impl
      * @brief Validate a member using member with the same path of sample object.
      *
      * If sample does not contain member then check is ignored.
+     * Members of indexed master sample are taken from the index of the sample.
      */
     template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
     static status validate_with_master_sample(AdapterT&& adapter, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
     {
-        const auto& sample=extract(b)();
-        auto sample_might_have_path=is_member_path_valid(sample,member.path());
+        const auto& sample=extract(b);
+        auto sample_might_have_path=is_member_path_valid(sample(),member.path());
         return hana::if_(
             sample_might_have_path,
             [&prop,&op,&sample](const auto& adapter, const auto& member)
             {
-                if (!exists(sample,member.path()))
-                {
-                    // if sample does not have member then ignore check
-                    return status(status::code::ignore);
-                }
-
-                return status(
-                        op(
-                            property(embedded_object_member(adapter,member),prop),
-                            property(get_member(sample,member.path()),prop)
-                        )
-                    );
+                return with_sample_member(
+                    sample,
+                    member.path(),
+                    [&](const auto& sample_member)
+                    {
+                        return status(
+                                op(
+                                    property(embedded_object_member(adapter,member),prop),
+                                    property(sample_member,prop)
+                                )
+                            );
+                    },
+                    []()
+                    {
+                        // if sample does not have member then ignore check
+                        return status(status::code::ignore);
+                    }
+                );
             },
             [](const auto&,const auto&)
             {
@@ -165,10 +175,12 @@ struct default_adapter_impl
     template <typename PredicateT, typename AdapterT, typename OpsT>
     static status validate_aggregation(const PredicateT& pred, AdapterT&& adapter, OpsT&& ops)
     {
-        return while_each(
-                  ops,
+        // members resolved by some validators of aggregation are reused by other validators
+        auto scope=member_lookup_scope(adapter,ops);
+        return while_each_collect_failures(
+                  adapter,
                   pred,
-                  status(status::code::ignore),
+                  ops,
                   [&adapter](auto&& op)
                   {
                     return status(apply(std::forward<AdapterT>(adapter),std::forward<decltype(op)>(op)));
@@ -223,7 +235,8 @@ struct default_adapter_impl
     template <typename AdapterT, typename OpT>
     static status validate_not(AdapterT&& adapter, OpT&& op)
     {
-        return status(!apply(std::forward<AdapterT>(adapter),std::forward<decltype(op)>(op)));
+        failures_scope<std::remove_reference_t<AdapterT>> scope(adapter,false);
+        return scope.close(status(!apply(std::forward<AdapterT>(adapter),std::forward<decltype(op)>(op))));
     }
 
     /**
@@ -232,7 +245,8 @@ struct default_adapter_impl
     template <typename AdapterT, typename MemberT, typename OpT>
     static status validate_not(AdapterT&& adapter, MemberT&& member, OpT&& op)
     {
-        return status(!apply_member(std::forward<decltype(adapter)>(adapter),std::forward<decltype(op)>(op),std::forward<decltype(member)>(member)));
+        failures_scope<std::remove_reference_t<AdapterT>> scope(adapter,false);
+        return scope.close(status(!apply_member(std::forward<decltype(adapter)>(adapter),std::forward<decltype(op)>(op),std::forward<decltype(member)>(member))));
     }
 };
 
@@ -0,0 +1,675 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/impl/failure_collector.hpp
+*
+*  Defines collector of failures used in collect-all-failures mode of adapters.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_FAILURE_COLLECTOR_HPP
+#define DRACOSHA_VALIDATOR_FAILURE_COLLECTOR_HPP
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/status.hpp>
+#include <dracosha/validator/utils/conditional_fold.hpp>
+#include <dracosha/validator/adapters/adapter_traits_wrapper.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Collector of failures in collect-all-failures mode.
+ *
+ * By default aggregations stop at the first failure. When collect-all-failures mode is enabled
+ * then AND aggregations and ALL element aggregations continue past failed operands and elements
+ * and count them as failures. Only failures within the budget are collected, i.e. reported by reporting adapters.
+ * Each failed element of ALL aggregation is reported by its own name.
+ * When the budget is exhausted the rest of operands and elements are still validated but reports of them are suspended
+ * and failures are only counted in the number of skipped failures, so that memory used for reports does not depend
+ * on the number of elements of validated containers.
+ *
+ * Aggregations that succeed if some of the operands succeeds, i.e. OR, ANY, and NOT aggregations, are not expanded
+ * and each of them is counted as a single failure.
+ *
+ * Counters are reset when a validation pass starts, i.e. when apply() of the outermost validator is invoked.
+ * Counters are not copied when adapter traits are copied.
+ */
+class failure_collector
+{
+    public:
+
+        /**
+         * @brief Default maximum number of failures to collect.
+         */
+        constexpr static const size_t default_failures_budget=100;
+
+        failure_collector() noexcept
+            : _enabled(false),
+              _budget(default_failures_budget),
+              _depth(0),
+              _suspended(0),
+              _collected(0),
+              _skipped(0)
+        {}
+
+        ~failure_collector()=default;
+
+        failure_collector(const failure_collector& other) noexcept
+            : failure_collector()
+        {
+            _enabled=other._enabled;
+            _budget=other._budget;
+        }
+
+        failure_collector(failure_collector&& other) noexcept
+            : failure_collector(static_cast<const failure_collector&>(other))
+        {}
+
+        failure_collector& operator= (const failure_collector& other) noexcept
+        {
+            _enabled=other._enabled;
+            _budget=other._budget;
+            return *this;
+        }
+
+        failure_collector& operator= (failure_collector&& other) noexcept
+        {
+            return *this=static_cast<const failure_collector&>(other);
+        }
+
+        /**
+         * @brief Enable or disable collect-all-failures mode.
+         * @param enable Flag.
+         * @param budget Maximum number of failures to collect.
+         */
+        void set_collect_all_failures(bool enable, size_t budget=default_failures_budget) noexcept
+        {
+            _enabled=enable;
+            _budget=budget;
+        }
+
+        /**
+         * @brief Check if collect-all-failures mode is enabled.
+         * @return Result of checking.
+         */
+        bool is_collect_all_failures() const noexcept
+        {
+            return _enabled;
+        }
+
+        /**
+         * @brief Get maximum number of failures to collect.
+         * @return Budget of failures.
+         */
+        size_t failures_budget() const noexcept
+        {
+            return _budget;
+        }
+
+        /**
+         * @brief Get number of failures collected in the last validation pass.
+         * @return Number of failures within the budget.
+         */
+        size_t collected_failure_count() const noexcept
+        {
+            return _collected;
+        }
+
+        /**
+         * @brief Get number of failures that were not collected in the last validation pass because the budget was exhausted.
+         * @return Number of failures beyond the budget.
+         */
+        size_t skipped_failure_count() const noexcept
+        {
+            return _skipped;
+        }
+
+        /**
+         * @brief Get total number of failures found in the last validation pass.
+         * @return Number of collected and skipped failures.
+         */
+        size_t failure_count() const noexcept
+        {
+            return _collected+_skipped;
+        }
+
+        /**
+         * @brief Reset counters of failures.
+         */
+        void reset_failures() const noexcept
+        {
+            _collected=0;
+            _skipped=0;
+        }
+
+        /**
+         * @brief Open validation pass, counters are reset if it is the outermost pass.
+         */
+        void open_failures_pass() const noexcept
+        {
+            if (_depth++==0)
+            {
+                reset_failures();
+            }
+        }
+
+        /**
+         * @brief Close validation pass.
+         * @param ret Validation status.
+         *
+         * If the outermost pass failed but no failures were counted then the pass itself is counted as a failure.
+         */
+        void close_failures_pass(const status& ret) const noexcept
+        {
+            if (--_depth==0 && !ret && failure_count()==0)
+            {
+                add_failure();
+            }
+        }
+
+        /**
+         * @brief Open scope of aggregation.
+         * @param collecting Flag that aggregation collects failures, otherwise collecting is suspended within the scope.
+         */
+        void open_failures_scope(bool collecting) const noexcept
+        {
+            open_failures_pass();
+            if (!collecting)
+            {
+                ++_suspended;
+            }
+        }
+
+        /**
+         * @brief Close scope of aggregation.
+         * @param collecting Flag that was used when the scope was opened.
+         * @param ret Status of aggregation.
+         */
+        void close_failures_scope(bool collecting, const status& ret) const noexcept
+        {
+            if (!collecting)
+            {
+                --_suspended;
+            }
+            close_failures_pass(ret);
+        }
+
+        /**
+         * @brief Check if failures must be collected at current level.
+         * @return True if mode is enabled and current level is not within aggregation that suspends collecting.
+         */
+        bool is_collecting_failures() const noexcept
+        {
+            return _enabled && _suspended==0;
+        }
+
+        /**
+         * @brief Check if budget of failures is exhausted.
+         * @return Result of checking.
+         */
+        bool is_failures_budget_exhausted() const noexcept
+        {
+            return _collected>=_budget;
+        }
+
+        /**
+         * @brief Count a failure.
+         */
+        void add_failure() const noexcept
+        {
+            if (is_failures_budget_exhausted())
+            {
+                ++_skipped;
+            }
+            else
+            {
+                ++_collected;
+            }
+        }
+
+    private:
+
+        bool _enabled;
+        size_t _budget;
+
+        mutable size_t _depth;
+        mutable size_t _suspended;
+        mutable size_t _collected;
+        mutable size_t _skipped;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Check if adapter supports collect-all-failures mode.
+ */
+template <typename AdapterT>
+using has_failure_collector=std::is_base_of<failure_collector,std::decay_t<decltype(traits_of(std::declval<AdapterT>()))>>;
+
+/**
+ * @brief Check if collect-all-failures mode is enabled in adapter.
+ * @param adapter Adapter.
+ * @return Result of checking, always false for adapters that do not support the mode.
+ */
+template <typename AdapterT>
+bool is_collect_all_failures(const AdapterT& adapter) noexcept
+{
+    return hana::eval_if(
+        has_failure_collector<AdapterT>{},
+        [&](auto&& _)
+        {
+            return traits_of(_(adapter)).is_collect_all_failures();
+        },
+        [](auto&&)
+        {
+            return false;
+        }
+    );
+}
+
+namespace detail
+{
+
+/**
+ * @brief Check if traits can suspend reports.
+ */
+template <typename TraitsT, typename=hana::when<true>>
+struct can_suspend_reports : public std::false_type
+{};
+
+/**
+ * @brief Check if traits can suspend reports.
+ *
+ * Specialization for traits with suspend_reports() and resume_reports() methods, e.g. traits of reporting adapters.
+ */
+template <typename TraitsT>
+struct can_suspend_reports<TraitsT,
+            hana::when_valid<
+                decltype(std::declval<TraitsT&>().suspend_reports()),
+                decltype(std::declval<TraitsT&>().resume_reports())
+            >
+        > : public std::true_type
+{};
+
+/**
+ * @brief Check if traits can list all reported elements of ALL aggregation.
+ */
+template <typename TraitsT, typename=hana::when<true>>
+struct can_list_reports : public std::false_type
+{};
+
+/**
+ * @brief Check if traits can list all reported elements of ALL aggregation.
+ *
+ * Specialization for traits with list_reports() method, e.g. traits of reporting adapters.
+ */
+template <typename TraitsT>
+struct can_list_reports<TraitsT,
+            hana::when_valid<
+                decltype(std::declval<TraitsT&>().list_reports())
+            >
+        > : public std::true_type
+{};
+
+/**
+ * @brief Guard that suspends reports of adapter traits and resumes them in destructor.
+ */
+template <typename TraitsT>
+class suspend_reports_guard
+{
+    public:
+
+        suspend_reports_guard(TraitsT& traits) : _traits(traits)
+        {
+            _traits.suspend_reports();
+        }
+
+        ~suspend_reports_guard()
+        {
+            _traits.resume_reports();
+        }
+
+        suspend_reports_guard(const suspend_reports_guard&)=delete;
+        suspend_reports_guard(suspend_reports_guard&&)=delete;
+        suspend_reports_guard& operator= (const suspend_reports_guard&)=delete;
+        suspend_reports_guard& operator= (suspend_reports_guard&&)=delete;
+
+    private:
+
+        TraitsT& _traits;
+};
+
+}
+
+/**
+ * @brief Scope of aggregation in collect-all-failures mode.
+ *
+ * Scope is opened in constructor. Status of aggregation is finalized in close(), the scope itself is closed in destructor,
+ * so that counters of the collector are restored if validation throws.
+ * If collecting is not applicable to the adapter then all methods are no-op.
+ */
+template <typename AdapterT, typename=hana::when<true>>
+class failures_scope
+{
+    public:
+
+        failures_scope(AdapterT&, bool)
+        {}
+
+        bool collecting() const noexcept
+        {
+            return false;
+        }
+
+        void list_elements() const noexcept
+        {}
+
+        template <typename HandlerT>
+        status invoke(HandlerT&& handler) const
+        {
+            return status(handler());
+        }
+
+        status close(status ret) const noexcept
+        {
+            return ret;
+        }
+};
+
+/**
+ * @brief Scope of aggregation in collect-all-failures mode.
+ *
+ * Specialization for adapters whose traits are derived from failure_collector.
+ */
+template <typename AdapterT>
+class failures_scope<AdapterT,hana::when<has_failure_collector<AdapterT>::value>>
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param adapter Adapter.
+         * @param collecting_aggregation Flag that aggregation can collect failures, i.e. it is AND or ALL aggregation.
+         */
+        failures_scope(AdapterT& adapter, bool collecting_aggregation)
+            : _adapter(adapter),
+              _collector(traits_of(adapter)),
+              _enabled(_collector.is_collect_all_failures()),
+              _collecting_aggregation(collecting_aggregation),
+              _failed(false),
+              _closed(false)
+        {
+            if (_enabled)
+            {
+                _collecting=_collecting_aggregation && _collector.is_collecting_failures();
+                _collector.open_failures_scope(_collecting_aggregation);
+            }
+            else
+            {
+                _collecting=false;
+            }
+        }
+
+        failures_scope(const failures_scope&)=delete;
+        failures_scope(failures_scope&&)=delete;
+        failures_scope& operator= (const failures_scope&)=delete;
+        failures_scope& operator= (failures_scope&&)=delete;
+
+        /**
+         * @brief Destructor.
+         *
+         * Closes the scope if it was not closed with close(), e.g. when validation throws.
+         */
+        ~failures_scope()
+        {
+            if (_enabled && !_closed)
+            {
+                _collector.close_failures_scope(_collecting_aggregation,status(status::code::ignore));
+            }
+        }
+
+        /**
+         * @brief Check if aggregation must continue past failures.
+         * @return Result of checking.
+         */
+        bool collecting() const noexcept
+        {
+            return _collecting;
+        }
+
+        /**
+         * @brief Report each failed element of ALL aggregation instead of the first one.
+         *
+         * Has effect only if the aggregation collects failures and the adapter supports listing of reports.
+         */
+        void list_elements()
+        {
+            if (_collecting)
+            {
+                list_reports(detail::can_list_reports<std::decay_t<decltype(traits_of(_adapter))>>{});
+            }
+        }
+
+        /**
+         * @brief Invoke handler of operand or element of aggregation and count failure.
+         * @param handler Handler.
+         * @return Status returned by handler.
+         *
+         * If aggregation does not collect failures then the handler is just invoked.
+         * If the budget of failures is exhausted then reports are suspended during invocation of the handler.
+         * If the handler fails and no failures were counted by nested aggregations then the handler's failure is counted.
+         */
+        template <typename HandlerT>
+        status invoke(HandlerT&& handler)
+        {
+            if (!_collecting)
+            {
+                return status(handler());
+            }
+
+            auto count=_collector.failure_count();
+            status ret=_collector.is_failures_budget_exhausted() ? invoke_suspended(handler) : status(handler());
+            if (!ret)
+            {
+                _failed=true;
+                if (_collector.failure_count()==count)
+                {
+                    _collector.add_failure();
+                }
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Close scope.
+         * @param ret Status of aggregation as if all operands were processed.
+         * @return Status of aggregation that is failed if any operand failed.
+         */
+        status close(status ret) noexcept
+        {
+            if (_failed)
+            {
+                ret=status(status::code::fail);
+            }
+            if (_enabled && !_closed)
+            {
+                _closed=true;
+                _collector.close_failures_scope(_collecting_aggregation,ret);
+            }
+            return ret;
+        }
+
+    private:
+
+        void list_reports(std::true_type)
+        {
+            traits_of(_adapter).list_reports();
+        }
+
+        void list_reports(std::false_type) noexcept
+        {}
+
+        template <typename HandlerT>
+        status invoke_suspended(HandlerT& handler)
+        {
+            return hana::eval_if(
+                detail::can_suspend_reports<std::decay_t<decltype(traits_of(_adapter))>>{},
+                [&](auto&& _)
+                {
+                    auto& traits=traits_of(_(_adapter));
+                    detail::suspend_reports_guard<std::decay_t<decltype(traits)>> guard(traits);
+                    return status(_(handler)());
+                },
+                [&](auto&& _)
+                {
+                    return status(_(handler)());
+                }
+            );
+        }
+
+        AdapterT& _adapter;
+        const failure_collector& _collector;
+        bool _enabled;
+        bool _collecting_aggregation;
+        bool _collecting;
+        bool _failed;
+        bool _closed;
+};
+
+/**
+ * @brief Scope of validation pass in collect-all-failures mode.
+ *
+ * Pass is opened in constructor and closed either in close() or in destructor if validation throws.
+ * Counters of failures are reset when the outermost pass is opened, so that they describe only the last validation
+ * even if the validator has no aggregations.
+ * If collecting is not applicable to the adapter then all methods are no-op.
+ */
+template <typename AdapterT, typename=hana::when<true>>
+class failures_pass_scope
+{
+    public:
+
+        failures_pass_scope(const AdapterT&) noexcept
+        {}
+
+        template <typename T>
+        T close(T&& ret) const noexcept
+        {
+            return std::forward<T>(ret);
+        }
+};
+
+/**
+ * @brief Scope of validation pass in collect-all-failures mode.
+ *
+ * Specialization for adapters whose traits are derived from failure_collector.
+ */
+template <typename AdapterT>
+class failures_pass_scope<AdapterT,hana::when<has_failure_collector<AdapterT>::value>>
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param adapter Adapter.
+         */
+        failures_pass_scope(const AdapterT& adapter) noexcept
+            : _collector(traits_of(adapter)),
+              _enabled(_collector.is_collect_all_failures())
+        {
+            if (_enabled)
+            {
+                _collector.open_failures_pass();
+            }
+        }
+
+        failures_pass_scope(const failures_pass_scope&)=delete;
+        failures_pass_scope(failures_pass_scope&&)=delete;
+        failures_pass_scope& operator= (const failures_pass_scope&)=delete;
+        failures_pass_scope& operator= (failures_pass_scope&&)=delete;
+
+        ~failures_pass_scope()
+        {
+            if (_enabled)
+            {
+                _collector.close_failures_pass(status(status::code::ignore));
+            }
+        }
+
+        /**
+         * @brief Close pass.
+         * @param ret Validation status.
+         * @return Validation status as is.
+         */
+        template <typename T>
+        T close(T&& ret) noexcept
+        {
+            if (_enabled)
+            {
+                _enabled=false;
+                _collector.close_failures_pass(status(ret));
+            }
+            return std::forward<T>(ret);
+        }
+
+    private:
+
+        const failure_collector& _collector;
+        bool _enabled;
+};
+
+/**
+ * @brief Check if aggregation with given predicate can collect failures.
+ *
+ * Only AND aggregations can continue past failures.
+ */
+template <typename PredicateT>
+using is_collecting_predicate=std::is_same<std::decay_t<PredicateT>,predicate_and_impl>;
+
+/**
+ * @brief Invoke handler on each operand of aggregation taking into account collect-all-failures mode.
+ * @param adapter Adapter.
+ * @param pred Predicate of aggregation.
+ * @param ops Operands of aggregation.
+ * @param handler Handler to invoke on each operand.
+ * @return Status of aggregation.
+ *
+ * If collecting failures is not enabled then it is equivalent to while_each().
+ */
+template <typename AdapterT, typename PredicateT, typename OpsT, typename HandlerT>
+status while_each_collect_failures(AdapterT& adapter, const PredicateT& pred, const OpsT& ops, const HandlerT& handler)
+{
+    failures_scope<AdapterT> scope(adapter,is_collecting_predicate<PredicateT>::value);
+    if (scope.collecting())
+    {
+        return scope.close(
+                    while_each(
+                        ops,
+                        [](const status&){return true;},
+                        status(status::code::ignore),
+                        [&scope,&handler](auto&& op)
+                        {
+                            return scope.invoke([&handler,&op](){return status(handler(std::forward<decltype(op)>(op)));});
+                        }
+                    )
+                );
+    }
+    return scope.close(while_each(ops,pred,status(status::code::ignore),handler));
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_FAILURE_COLLECTOR_HPP
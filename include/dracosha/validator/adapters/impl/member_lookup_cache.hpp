@@ -0,0 +1,464 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/impl/member_lookup_cache.hpp
+*
+*  Defines cache of members resolved within a validation pass.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_MEMBER_LOOKUP_CACHE_HPP
+#define DRACOSHA_VALIDATOR_MEMBER_LOOKUP_CACHE_HPP
+
+#include <array>
+#include <memory>
+#include <functional>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/check_member_path.hpp>
+#include <dracosha/validator/adapters/adapter_traits_wrapper.hpp>
+#include <dracosha/validator/adapters/impl/intermediate_adapter_traits.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Cache of members resolved within a validation pass.
+ *
+ * Cache is used by adapter traits to avoid repeated lookups of the same member when
+ * the member is used in a number of sibling checks, e.g. validator(_["field1"](gte,0),_["field1"](lte,100)).
+ * Both references to resolved members and results of checking of members existence are cached.
+ *
+ * Cache is active only within a validation scope, see member_lookup_scope(). The scope is opened
+ * by the outermost aggregation and the cache is cleared when the scope is closed,
+ * thus resolved references never outlive the validation pass.
+ *
+ * Entries are keyed by member paths. Only paths that belong to the validator that opened the scope are cached,
+ * so that paths of temporary members, e.g. members generated for elements of aggregations,
+ * can never be referred by the cache after they are destroyed.
+ *
+ * Cache is disabled by default and must be enabled explicitly with set_member_lookup_cache_enabled().
+ * While the cache is disabled it keeps no state during validation, so the adapter can be shared by a number of threads.
+ * Enabled cache is modified during validation, thus the adapter must not be used in a few threads at the same time.
+ *
+ * Cache is not copied when adapter traits are copied.
+ */
+class member_lookup_cache
+{
+    public:
+
+        /**
+         * @brief Maximum number of members in the cache.
+         */
+        constexpr static const size_t lookup_cache_capacity=8;
+
+        member_lookup_cache() noexcept
+            : _enabled(false),
+              _depth(0),
+              _count(0),
+              _next(0),
+              _owner_begin(nullptr),
+              _owner_end(nullptr)
+        {}
+
+        ~member_lookup_cache()=default;
+
+        member_lookup_cache(const member_lookup_cache& other) noexcept
+            : member_lookup_cache()
+        {
+            _enabled=other._enabled;
+        }
+
+        member_lookup_cache(member_lookup_cache&& other) noexcept
+            : member_lookup_cache()
+        {
+            _enabled=other._enabled;
+        }
+
+        member_lookup_cache& operator= (const member_lookup_cache& other) noexcept
+        {
+            _enabled=other._enabled;
+            return *this;
+        }
+
+        member_lookup_cache& operator= (member_lookup_cache&& other) noexcept
+        {
+            _enabled=other._enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Enable or disable member lookup cache.
+         * @param enable Flag.
+         *
+         * Cache is worth enabling for validators that use the same members in a number of checks.
+         * Adapter with enabled cache must not be used for validation in a few threads at the same time.
+         */
+        void set_member_lookup_cache_enabled(bool enable) noexcept
+        {
+            _enabled=enable;
+        }
+
+        /**
+         * @brief Check if member lookup cache is enabled.
+         * @return Result of checking.
+         */
+        bool is_member_lookup_cache_enabled() const noexcept
+        {
+            return _enabled;
+        }
+
+        /**
+         * @brief Open validation scope.
+         * @param owner_begin Begin of memory of validator that opens the scope.
+         * @param owner_end End of memory of validator that opens the scope.
+         */
+        void open_scope(const void* owner_begin, const void* owner_end) const noexcept
+        {
+            if (_depth++==0)
+            {
+                _owner_begin=owner_begin;
+                _owner_end=owner_end;
+            }
+        }
+
+        /**
+         * @brief Close validation scope.
+         *
+         * When the outermost scope is closed then the cache is cleared.
+         */
+        void close_scope() const noexcept
+        {
+            if (--_depth==0)
+            {
+                _count=0;
+                _next=0;
+                _owner_begin=nullptr;
+                _owner_end=nullptr;
+            }
+        }
+
+        /**
+         * @brief Get member using cache.
+         * @param path Member's path.
+         * @param fn Handler to invoke to resolve the member if it is not found in the cache.
+         * @return Reference to resolved member.
+         */
+        template <typename RefT, typename PathT, typename FnT>
+        RefT cached_member(const PathT& path, FnT&& fn) const
+        {
+            using value_type=std::remove_reference_t<RefT>;
+
+            if (_depth==0)
+            {
+                return fn();
+            }
+            auto* item=find(path);
+            if (item!=nullptr && item->value!=nullptr)
+            {
+                return *static_cast<value_type*>(const_cast<void*>(item->value));
+            }
+
+            RefT ref=fn();
+            if (item==nullptr)
+            {
+                item=insert(path);
+            }
+            if (item!=nullptr)
+            {
+                item->value=std::addressof(ref);
+                item->exists_known=true;
+                item->exists=true;
+            }
+            return static_cast<RefT>(ref);
+        }
+
+        /**
+         * @brief Check if member exists using cache.
+         * @param path Member's path.
+         * @param fn Handler to invoke to check if member exists if existence of the member is not found in the cache.
+         * @return Result of checking.
+         */
+        template <typename PathT, typename FnT>
+        bool cached_exists(const PathT& path, FnT&& fn) const
+        {
+            if (_depth==0)
+            {
+                return fn();
+            }
+            auto* item=find(path);
+            if (item!=nullptr && item->exists_known)
+            {
+                return item->exists;
+            }
+
+            bool ok=fn();
+            if (item==nullptr)
+            {
+                item=insert(path);
+            }
+            if (item!=nullptr)
+            {
+                item->exists_known=true;
+                item->exists=ok;
+            }
+            return ok;
+        }
+
+    private:
+
+        struct entry
+        {
+            const void* tag;
+            const void* path;
+            const void* value;
+            bool exists_known;
+            bool exists;
+        };
+
+        template <typename PathT>
+        static const void* type_tag() noexcept
+        {
+            static const char tag=0;
+            return &tag;
+        }
+
+        using equal_fn=bool (*)(const void*, const void*);
+
+        template <typename PathT>
+        static bool equal_paths(const void* left, const void* right)
+        {
+            return paths_equal(*static_cast<const PathT*>(left),*static_cast<const PathT*>(right));
+        }
+
+        template <typename PathT>
+        entry* find(const PathT& path) const
+        {
+            return find(type_tag<PathT>(),std::addressof(path),&equal_paths<PathT>);
+        }
+
+        entry* find(const void* tag, const void* path, equal_fn equal) const
+        {
+            for (size_t i=0;i<_count;i++)
+            {
+                auto& item=_entries[i];
+                if (item.tag==tag && (item.path==path || equal(item.path,path)))
+                {
+                    return &item;
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename PathT>
+        entry* insert(const PathT& path) const
+        {
+            return insert(type_tag<PathT>(),std::addressof(path));
+        }
+
+        entry* insert(const void* tag, const void* path) const
+        {
+            if (!is_owned(path))
+            {
+                return nullptr;
+            }
+
+            auto& item=_entries[_next];
+            item.tag=tag;
+            item.path=path;
+            item.value=nullptr;
+            item.exists_known=false;
+            item.exists=false;
+
+            _next=(_next+1)%lookup_cache_capacity;
+            if (_count<lookup_cache_capacity)
+            {
+                ++_count;
+            }
+            return &item;
+        }
+
+        bool is_owned(const void* ptr) const noexcept
+        {
+            std::less<const void*> less;
+            return !less(ptr,_owner_begin) && less(ptr,_owner_end);
+        }
+
+        bool _enabled;
+        mutable size_t _depth;
+        mutable size_t _count;
+        mutable size_t _next;
+        mutable const void* _owner_begin;
+        mutable const void* _owner_end;
+        mutable std::array<entry,lookup_cache_capacity> _entries;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Check if adapter can use member lookup cache.
+ *
+ * Only adapters whose traits are derived from member_lookup_cache can use the cache.
+ * Intermediate adapters do not use the cache because they already hold pre-extracted members.
+ */
+template <typename AdapterT>
+using has_member_lookup_cache=std::integral_constant<bool,
+        std::is_base_of<member_lookup_cache,std::decay_t<decltype(traits_of(std::declval<AdapterT>()))>>::value
+        &&
+        !std::is_base_of<intermediate_adapter_tag,typename std::decay_t<AdapterT>::type>::value
+    >;
+
+/**
+ * @brief Validation scope of member lookup cache.
+ *
+ * Scope is opened in constructor and closed in destructor.
+ */
+class member_lookup_scope_guard
+{
+    public:
+
+        member_lookup_scope_guard(const member_lookup_cache* cache=nullptr, const void* owner_begin=nullptr, const void* owner_end=nullptr) noexcept
+            : _cache(cache)
+        {
+            if (_cache!=nullptr)
+            {
+                _cache->open_scope(owner_begin,owner_end);
+            }
+        }
+
+        ~member_lookup_scope_guard()
+        {
+            if (_cache!=nullptr)
+            {
+                _cache->close_scope();
+            }
+        }
+
+        member_lookup_scope_guard(member_lookup_scope_guard&& other) noexcept
+            : _cache(other._cache)
+        {
+            other._cache=nullptr;
+        }
+
+        member_lookup_scope_guard(const member_lookup_scope_guard&)=delete;
+        member_lookup_scope_guard& operator= (const member_lookup_scope_guard&)=delete;
+        member_lookup_scope_guard& operator= (member_lookup_scope_guard&&)=delete;
+
+    private:
+
+        const member_lookup_cache* _cache;
+};
+
+/**
+ * @brief Implementer of member_lookup_scope().
+ */
+struct member_lookup_scope_impl
+{
+    template <typename AdapterT, typename OwnerT>
+    member_lookup_scope_guard operator() (const AdapterT& adapter, const OwnerT& owner) const noexcept
+    {
+        return hana::eval_if(
+            has_member_lookup_cache<AdapterT>{},
+            [&](auto&& _)
+            {
+                const auto& cache=traits_of(_(adapter));
+                if (!cache.is_member_lookup_cache_enabled())
+                {
+                    return member_lookup_scope_guard();
+                }
+                const auto* begin=reinterpret_cast<const char*>(std::addressof(_(owner)));
+                return member_lookup_scope_guard(&cache,begin,begin+sizeof(OwnerT));
+            },
+            [](auto&&)
+            {
+                return member_lookup_scope_guard();
+            }
+        );
+    }
+};
+/**
+ * @brief Open validation scope of member lookup cache.
+ * @param adapter Validation adapter.
+ * @param owner Validator or its part that holds members used within the scope.
+ * @return Scope guard that closes the scope when destroyed.
+ */
+constexpr member_lookup_scope_impl member_lookup_scope{};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementer of lookup_member_cached().
+ */
+struct lookup_member_cached_impl
+{
+    template <typename AdapterT, typename PathT, typename FnT>
+    auto operator() (const AdapterT& adapter, const PathT& path, FnT&& fn) const -> decltype(auto)
+    {
+        using result_type=decltype(fn());
+        return hana::eval_if(
+            hana::bool_c<has_member_lookup_cache<AdapterT>::value && std::is_lvalue_reference<result_type>::value>,
+            [&](auto&& _) -> result_type
+            {
+                return traits_of(_(adapter)).template cached_member<result_type>(_(path),_(fn));
+            },
+            [&](auto&& _) -> decltype(auto)
+            {
+                return _(fn)();
+            }
+        );
+    }
+};
+/**
+ * @brief Get member using member lookup cache of adapter if applicable.
+ * @param adapter Validation adapter.
+ * @param path Member's path.
+ * @param fn Handler to invoke to resolve the member if the cache is not applicable or member is not found in the cache.
+ * @return Member.
+ */
+constexpr lookup_member_cached_impl lookup_member_cached{};
+
+/**
+ * @brief Implementer of lookup_exists_cached().
+ */
+struct lookup_exists_cached_impl
+{
+    template <typename AdapterT, typename PathT, typename FnT>
+    bool operator() (const AdapterT& adapter, const PathT& path, FnT&& fn) const
+    {
+        return hana::eval_if(
+            has_member_lookup_cache<AdapterT>{},
+            [&](auto&& _)
+            {
+                return traits_of(_(adapter)).cached_exists(_(path),_(fn));
+            },
+            [&](auto&& _)
+            {
+                return static_cast<bool>(_(fn)());
+            }
+        );
+    }
+};
+/**
+ * @brief Check if member exists using member lookup cache of adapter if applicable.
+ * @param adapter Validation adapter.
+ * @param path Member's path.
+ * @param fn Handler to invoke to check existence if the cache is not applicable or member is not found in the cache.
+ * @return Result of checking.
+ */
+constexpr lookup_exists_cached_impl lookup_exists_cached{};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_MEMBER_LOOKUP_CACHE_HPP
@@ -50,13 +50,19 @@ struct make_intermediate_adapter_impl
             )(std::forward<decltype(current_traits)>(current_traits));
 
             auto&& obj=embedded_object_member(adapter,path);
+            // temporary values, e.g. values returned by property getters, are owned by intermediate adapter
+            using intermediate_type=std::conditional_t<
+                std::is_lvalue_reference<decltype(obj)>::value,
+                decltype(obj),
+                std::decay_t<decltype(obj)>
+            >;
             return intermediate_adapter_traits<
                         std::decay_t<decltype(traits)>,
-                        decltype(obj),
+                        intermediate_type,
                         decltype(path_prefix_length)
                     >{
                         traits,
-                        obj,
+                        std::forward<decltype(obj)>(obj),
                         path_prefix_length
                      };
         };
@@ -0,0 +1,83 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/parallel_adapter.hpp
+*
+*  Defines adapter that processes element aggregations in a thread pool.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_PARALLEL_ADAPTER_HPP
+#define DRACOSHA_VALIDATOR_PARALLEL_ADAPTER_HPP
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/thread_pool.hpp>
+#include <dracosha/validator/aggregation/parallel_aggregation.hpp>
+#include <dracosha/validator/adapters/default_adapter.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Traits of parallel adapter.
+ */
+template <typename T>
+class parallel_adapter_traits : public default_adapter_traits<T>,
+                                public parallel_aggregation_tag
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param obj Object to wrap into adapter.
+         * @param pool Thread pool to use for parallel processing of element aggregations.
+         * @param chunk_size Minimal number of elements processed by a single worker at once.
+         */
+        parallel_adapter_traits(
+                    T&& obj,
+                    thread_pool& pool,
+                    size_t chunk_size=parallel_aggregation_tag::default_chunk_size
+                ) : default_adapter_traits<T>(std::forward<T>(obj)),
+                    parallel_aggregation_tag(&pool,chunk_size)
+        {}
+};
+
+/**
+ * @brief Parallel adapter performs validation like default adapter but splits ALL/ANY aggregations
+ * over random access containers into chunks processed by worker threads of a thread pool.
+ *
+ * Validation status is the same as the status of sequential validation with default adapter.
+ * Aggregations nested into aggregations that are already processed in parallel are processed sequentially.
+ * Operators and lazy operands used in validators must be thread safe.
+ */
+template <typename T>
+using parallel_adapter = adapter<parallel_adapter_traits<T>>;
+
+/**
+  @brief Make parallel validation adapter wrapping the embedded object.
+  @param v Object to wrap into adapter.
+  @param pool Thread pool to use for parallel processing of element aggregations.
+  @param chunk_size Minimal number of elements processed by a single worker at once.
+  @return Validation adapter.
+  */
+template <typename T>
+auto make_parallel_adapter(T&& v, thread_pool& pool, size_t chunk_size=parallel_aggregation_tag::default_chunk_size)
+{
+    return parallel_adapter<T>(std::forward<T>(v),pool,chunk_size);
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_PARALLEL_ADAPTER_HPP
@@ -0,0 +1,140 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/rebindable_adapter.hpp
+*
+*  Defines adapter that can be rebound to other objects.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_REBINDABLE_ADAPTER_HPP
+#define DRACOSHA_VALIDATOR_REBINDABLE_ADAPTER_HPP
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/status.hpp>
+#include <dracosha/validator/with_check_member_exists.hpp>
+#include <dracosha/validator/adapter.hpp>
+#include <dracosha/validator/adapters/impl/default_adapter_impl.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Traits of rebindable adapter.
+ */
+template <typename T>
+class rebindable_adapter_traits : public adapter_traits,
+                                  public with_check_member_exists<rebindable_adapter_traits<T>>,
+                                  public default_adapter_impl
+{
+    public:
+
+        using base_tag=adapter_traits;
+
+        /**
+         * @brief Constructor.
+         * @param obj Pointer to object under validation.
+         */
+        rebindable_adapter_traits(
+                    T* obj=nullptr
+                ) : with_check_member_exists<rebindable_adapter_traits<T>>(*this),
+                    _obj(obj)
+        {}
+
+        /**
+         * @brief Copy constructor.
+         * @param other Other traits.
+         *
+         * Base with_check_member_exists must refer to the new traits, thus it is not copied but settings are.
+         */
+        rebindable_adapter_traits(
+                    const rebindable_adapter_traits& other
+                ) : with_check_member_exists<rebindable_adapter_traits<T>>(*this),
+                    _obj(other._obj)
+        {
+            this->set_check_member_exists_before_validation(other.is_check_member_exists_before_validation());
+            this->set_unknown_member_mode(other.unknown_member_mode());
+        }
+
+        rebindable_adapter_traits& operator= (const rebindable_adapter_traits&)=delete;
+
+        /**
+         * @brief Bind adapter to other object.
+         * @param obj Object under validation.
+         */
+        void rebind(T& obj) noexcept
+        {
+            _obj=&obj;
+        }
+
+        /**
+         *  @brief Get object under validation.
+         */
+        const T& get() const noexcept
+        {
+            return *_obj;
+        }
+
+        /**
+         *  @brief Get object under validation.
+         */
+        T& get() noexcept
+        {
+            return *_obj;
+        }
+
+    private:
+
+        T* _obj;
+};
+
+/**
+ * @brief Rebindable adapter performs validation like default adapter but can be rebound to other objects.
+ *
+ * Rebindable adapter is used when the same validator is applied to a sequence of objects,
+ * so that the adapter and its settings are constructed only once for the whole sequence.
+ * Adapter keeps a pointer to the object under validation, the object must outlive the validation.
+ */
+template <typename T>
+class rebindable_adapter : public adapter<rebindable_adapter_traits<T>>
+{
+    public:
+
+        using adapter<rebindable_adapter_traits<T>>::adapter;
+
+        /**
+         * @brief Bind adapter to other object.
+         * @param obj Object under validation.
+         */
+        void rebind(T& obj) noexcept
+        {
+            this->traits().rebind(obj);
+        }
+};
+
+/**
+  @brief Make rebindable validation adapter.
+  @param obj Object to bind the adapter to.
+  @return Validation adapter.
+  */
+template <typename T>
+auto make_rebindable_adapter(T& obj)
+{
+    return rebindable_adapter<T>(&obj);
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_REBINDABLE_ADAPTER_HPP
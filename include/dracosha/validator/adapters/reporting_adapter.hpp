@@ -22,6 +22,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/utils/object_wrapper.hpp>
 #include <dracosha/validator/adapter.hpp>
+#include <dracosha/validator/adapters/impl/failure_collector.hpp>
 #include <dracosha/validator/reporting/reporter.hpp>
 #include <dracosha/validator/reporting/reporting_adapter_impl.hpp>
 
@@ -36,7 +37,8 @@ template <typename T, typename ReporterT>
 struct reporting_adapter_traits : public adapter_traits,
                                   public object_wrapper<T>,
                                   public with_check_member_exists<reporting_adapter_traits<T,ReporterT>>,
-                                  public reporting_adapter_impl<ReporterT,default_adapter_impl>
+                                  public reporting_adapter_impl<ReporterT,default_adapter_impl>,
+                                  public failure_collector
 {
     public:
 
@@ -113,6 +113,29 @@ struct aggregate_op
     using hana_tag=aggregation_op_tag;
 };
 
+/**
+ * @brief Handler of logical aggregation that keeps the list of aggregated validators.
+ *
+ * Aggregated validators are kept accessible so that the aggregation can be inspected, e.g. by compile().
+ */
+template <typename HandlerT, typename OpsT>
+struct aggregation_handler
+{
+    /**
+     * @brief Invoke aggregation handler appending the list of aggregated validators to arguments.
+     * @param args Arguments.
+     * @return Validation result.
+     */
+    template <typename ... Args>
+    auto operator () (Args&&... args) const -> decltype(auto)
+    {
+        return handler(std::forward<Args>(args)...,ops);
+    }
+
+    HandlerT handler;
+    OpsT ops;
+};
+
 /**
  * @brief Implementer of make_aggregation_validator.
  */
@@ -121,11 +144,12 @@ struct make_aggregation_validator_impl
     template <typename HandlerT, typename Ts>
     auto operator() (HandlerT&& handler, Ts&& xs) const
     {
-        auto fn=hana::reverse_partial(std::forward<HandlerT>(handler),xs);
         auto params=content_of_check_exists(xs);
+        using with_check_exists=decltype(is_validator_with_check_exists(xs));
+        auto fn=aggregation_handler<std::decay_t<HandlerT>,std::decay_t<Ts>>{std::forward<HandlerT>(handler),std::forward<Ts>(xs)};
         return base_validator<
                 decltype(fn),
-                decltype(is_validator_with_check_exists(xs)),
+                with_check_exists,
                 std::decay_t<decltype(params.second)>
                 >
             {
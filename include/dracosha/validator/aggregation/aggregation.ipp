@@ -31,6 +31,30 @@ DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+/**
+ * @brief Open aggregation report with member given by path if reporter can format the member lazily.
+ */
+template <typename ReporterT, typename AggregationT, typename PathT>
+auto aggregate_open_path(ReporterT& reporter, AggregationT&& str, const PathT& path, int)
+    -> decltype(reporter.aggregate_open_path(std::forward<AggregationT>(str),path))
+{
+    reporter.aggregate_open_path(std::forward<AggregationT>(str),path);
+}
+
+/**
+ * @brief Open aggregation report with member constructed from path if reporter does not support lazy members.
+ */
+template <typename ReporterT, typename AggregationT, typename PathT>
+void aggregate_open_path(ReporterT& reporter, AggregationT&& str, const PathT& path, long)
+{
+    reporter.aggregate_open(std::forward<AggregationT>(str),make_member(path));
+}
+
+}
+
 /**
  * @brief Helper for construction of element aggregation reports.
  */
@@ -64,7 +88,8 @@ struct aggregate_report<AdapterT,
             },
             [&](auto&& _)
             {
-                reporter.aggregate_open(str,make_member(_(path)));
+                // path stays valid until the report is closed
+                detail::aggregate_open_path(reporter,str,_(path),0);
             }
         );
     }
@@ -21,6 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/aggregation/element_aggregation.hpp>
+#include <dracosha/validator/aggregation/parallel_aggregation.hpp>
 #include <dracosha/validator/member.hpp>
 #include <dracosha/validator/extract.hpp>
 #include <dracosha/validator/get_member.hpp>
@@ -31,8 +32,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/embedded_object.hpp>
 #include <dracosha/validator/base_validator.hpp>
 #include <dracosha/validator/adapters/make_intermediate_adapter.hpp>
+#include <dracosha/validator/adapters/impl/failure_collector.hpp>
 #include <dracosha/validator/utils/heterogeneous_size.hpp>
 #include <dracosha/validator/utils/foreach_if.hpp>
+#include <dracosha/validator/utils/wrap_object.hpp>
 #include <dracosha/validator/aggregation/wrap_heterogeneous_index.hpp>
 #include <dracosha/validator/compact_variadic_property.hpp>
 
@@ -40,13 +43,22 @@ DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+/**
+ * @brief Check if element aggregation is ALL aggregation that can collect failures.
+ */
+template <typename AggregationT>
+using is_all_aggregation=std::integral_constant<bool,std::decay_t<AggregationT>::id==aggregation_id::ALL>;
+
+//-------------------------------------------------------------
+
 template <typename PredicateT, typename EmptyFnT, typename AggregationT,
           typename UsedPathSizeT, typename PathT, typename AdapterT, typename HandlerT>
 status element_aggregation::invoke(PredicateT&& pred, EmptyFnT&& empt, AggregationT&& aggr,
                      UsedPathSizeT&& used_path_size, PathT&& path, AdapterT&& adapter, HandlerT&& handler)
 {
     // invoke only if parent path is ok
-    const auto parent_path=hana::drop_back(path);
+    // keys of parent path refer to keys of the path to avoid copying them for each element
+    const auto parent_path=hana::drop_back(wrap_path_refs(path));
     if (!embedded_object_has_path(adapter,parent_path))
     {
         return traits_of(adapter).not_found_status();
@@ -66,20 +78,47 @@ status element_aggregation::invoke(PredicateT&& pred, EmptyFnT&& empt, Aggregati
                     const auto& el_aggregation=hana::back(path);
 
                     auto tmp_adapter=make_intermediate_adapter(_(adapter),_(parent_path));
+                    auto element_handler=[&](auto& element_adapter, const auto& it)
+                    {
+                        return _(handler)(element_adapter,hana::append(_(parent_path),wrap_it(it,_(aggr),el_aggregation.modifier)),_(used_path_size));
+                    };
 
                     aggregate_report<AdapterT>::open(_(adapter),_(aggr),_(parent_path));
-                    bool empty=true;
-                    for (auto it=_(parent_element).begin();it!=_(parent_element).end();++it)
+                    failures_scope<std::remove_reference_t<AdapterT>> scope(_(adapter),is_all_aggregation<AggregationT>::value);
+                    status ret;
+                    if (scope.collecting())
                     {
-                        status ret=_(handler)(tmp_adapter,hana::append(_(parent_path),wrap_it(it,_(aggr),el_aggregation.modifier)),_(used_path_size));
-                        if (!pred(ret))
-                        {
-                            aggregate_report<AdapterT>::close(_(adapter),ret);
-                            return ret;
-                        }
-                        empty=false;
+                        // in collect-all-failures mode elements are processed sequentially, failed elements do not stop the aggregation
+                        // and each failed element is reported by its own name
+                        scope.list_elements();
+                        size_t index=0;
+                        ret=detail::aggregate_elements_sequentially(
+                            [](const status&){return true;},
+                            empt,
+                            _(parent_element),
+                            tmp_adapter,
+                            [&](auto& element_adapter, const auto& it)
+                            {
+                                return scope.invoke(
+                                    [&]()
+                                    {
+                                        return _(handler)(element_adapter,hana::append(_(parent_path),wrap_listed_it(it,_(aggr),el_aggregation.modifier,index++)),_(used_path_size));
+                                    }
+                                );
+                            }
+                        );
+                    }
+                    else
+                    {
+                        ret=aggregate_elements<decltype(tmp_adapter),parent_type>::invoke(
+                            pred,
+                            empt,
+                            _(parent_element),
+                            tmp_adapter,
+                            element_handler
+                        );
                     }
-                    auto ret=empt(empty);
+                    ret=scope.close(ret);
                     aggregate_report<AdapterT>::close(_(adapter),ret);
                     return ret;
                 },
@@ -92,14 +131,15 @@ status element_aggregation::invoke(PredicateT&& pred, EmptyFnT&& empt, Aggregati
                             // agrregation can be invoked on heterogeneous container types
                             auto tmp_adapter=make_intermediate_adapter(_(adapter),_(parent_path));
                             aggregate_report<AdapterT>::open(_(adapter),_(aggr),_(parent_path));
-                            auto ret=foreach_if(
-                                            parent_element,
-                                            pred,
-                                            [&](auto&&, auto&& index)
-                                            {
-                                                return _(handler)(tmp_adapter,hana::append(_(parent_path),wrap_heterogeneous_index(index,_(aggr))),_(used_path_size));
-                                            }
-                                        );
+                            failures_scope<std::remove_reference_t<AdapterT>> scope(_(adapter),is_all_aggregation<AggregationT>::value);
+                            auto element_handler=[&](auto&&, auto&& index)
+                            {
+                                return scope.invoke([&](){return _(handler)(tmp_adapter,hana::append(_(parent_path),wrap_heterogeneous_index(index,_(aggr))),_(used_path_size));});
+                            };
+                            auto ret=scope.collecting()
+                                        ? foreach_if(parent_element,[](const status&){return true;},element_handler)
+                                        : foreach_if(parent_element,pred,element_handler);
+                            ret=scope.close(ret);
                             aggregate_report<AdapterT>::close(_(adapter),ret);
                             return ret;
                         },
@@ -137,28 +177,37 @@ status element_aggregation::invoke_variadic(PredicateT&& pred, EmptyFnT&& empt,
         is_embedded_object_path_valid(adapter,parent_compacted_path),
         [&](auto&& _)
         {
-            auto upper_path=hana::drop_back(_(path));
+            auto upper_path=hana::drop_back(wrap_path_refs(_(path)));
             auto&& parent=embedded_object_member(_(adapter),_(parent_compacted_path));
             const auto& aggregation_varg=unwrap_object(hana::back(_(path)));
 
             auto tmp_adapter=make_intermediate_adapter(_(adapter),_(parent_compacted_path));
 
             aggregate_report<AdapterT>::open(_(adapter),_(aggr),_(parent_compacted_path));
+            failures_scope<std::remove_reference_t<AdapterT>> scope(_(adapter),is_all_aggregation<AggregationT>::value);
+            scope.list_elements();
             bool empty=true;
             for (auto it=aggregation_varg.begin(parent);
                  aggregation_varg.while_cond(parent,it);
                  aggregation_varg.next(parent,it)
                 )
             {
-                status ret=_(handler)(tmp_adapter,hana::append(upper_path,varg(wrap_index(it,_(aggr)))),_(used_path_size));
-                if (!pred(ret))
+                // in collect-all-failures mode each failed element is reported by its own name
+                status ret=scope.invoke(
+                    [&]()
+                    {
+                        return _(handler)(tmp_adapter,hana::append(upper_path,varg(scope.collecting() ? wrap_listed_index(it,_(aggr)) : wrap_index(it,_(aggr)))),_(used_path_size));
+                    }
+                );
+                if (!scope.collecting() && !pred(ret))
                 {
+                    ret=scope.close(ret);
                     aggregate_report<AdapterT>::close(_(adapter),ret);
                     return ret;
                 }
                 empty=false;
             }
-            auto result=empt(empty);
+            auto result=scope.close(empt(empty));
             aggregate_report<AdapterT>::close(_(adapter),result);
             return result;
         },
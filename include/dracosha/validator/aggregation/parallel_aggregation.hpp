@@ -0,0 +1,192 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/aggregation/parallel_aggregation.hpp
+*
+*  Defines helpers for parallel processing of element aggregations.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_PARALLEL_AGGREGATION_HPP
+#define DRACOSHA_VALIDATOR_PARALLEL_AGGREGATION_HPP
+
+#include <iterator>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/status.hpp>
+#include <dracosha/validator/adapters/adapter_traits_wrapper.hpp>
+#include <dracosha/validator/utils/thread_pool.hpp>
+#include <dracosha/validator/utils/parallel_while_each.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Base class for adapter traits that can process element aggregations in parallel.
+ */
+class parallel_aggregation_tag
+{
+    public:
+
+        /**
+         * @brief Default minimal number of elements processed by a single worker at once.
+         */
+        constexpr static const size_t default_chunk_size=4096;
+
+        /**
+         * @brief Constructor.
+         * @param pool Thread pool to use for parallel processing, if null then aggregations are processed sequentially.
+         * @param chunk_size Minimal number of elements processed by a single worker at once.
+         */
+        parallel_aggregation_tag(thread_pool* pool=nullptr, size_t chunk_size=default_chunk_size) noexcept
+            : _pool(pool),
+              _chunk_size(chunk_size)
+        {}
+
+        void set_thread_pool(thread_pool* pool) noexcept
+        {
+            _pool=pool;
+        }
+        thread_pool* get_thread_pool() const noexcept
+        {
+            return _pool;
+        }
+
+        void set_parallel_chunk_size(size_t chunk_size) noexcept
+        {
+            _chunk_size=chunk_size;
+        }
+        size_t parallel_chunk_size() const noexcept
+        {
+            return _chunk_size;
+        }
+
+        /**
+         * @brief Check if aggregation over a number of elements must be processed in parallel.
+         * @param count Number of elements.
+         * @return True if thread pool is set, number of elements exceeds chunk size and this is not a nested aggregation in a worker thread.
+         */
+        bool is_parallel(size_t count) const noexcept
+        {
+            return _pool!=nullptr && count>_chunk_size && !thread_pool::is_worker_thread();
+        }
+
+        /**
+         * @brief Check if aggregation of unknown size, e.g. tree aggregation, must be processed in parallel.
+         * @return True if thread pool is set and this is not a nested aggregation in a worker thread.
+         */
+        bool is_parallel() const noexcept
+        {
+            return _pool!=nullptr && !thread_pool::is_worker_thread();
+        }
+
+    private:
+
+        thread_pool* _pool;
+        size_t _chunk_size;
+};
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+/**
+ * @brief Invoke handler for each element of container sequentially while predicate is satisfied.
+ * @param pred Logical predicate of aggregation.
+ * @param empt Handler of empty list of elements.
+ * @param container Container.
+ * @param adapter Adapter to pass to handler.
+ * @param handler Handler to invoke with adapter and iterator of element.
+ * @return Aggregated status.
+ */
+template <typename PredicateT, typename EmptyFnT, typename ContainerT, typename AdapterT, typename HandlerT>
+status aggregate_elements_sequentially(PredicateT&& pred, EmptyFnT&& empt, const ContainerT& container, AdapterT& adapter, HandlerT&& handler)
+{
+    bool empty=true;
+    for (auto it=container.begin();it!=container.end();++it)
+    {
+        status ret=handler(adapter,it);
+        if (!pred(ret))
+        {
+            return ret;
+        }
+        empty=false;
+    }
+    return empt(empty);
+}
+}
+
+/**
+ * @brief Helper for iterating over container elements in element aggregations.
+ *
+ * Default implementation iterates sequentially and stops when predicate is not satisfied.
+ */
+template <typename AdapterT, typename ContainerT, typename=hana::when<true>>
+struct aggregate_elements
+{
+    template <typename PredicateT, typename EmptyFnT, typename AdapterT1, typename HandlerT>
+    static status invoke(PredicateT&& pred, EmptyFnT&& empt, const ContainerT& container, AdapterT1& adapter, HandlerT&& handler)
+    {
+        return detail::aggregate_elements_sequentially(pred,empt,container,adapter,handler);
+    }
+};
+
+/**
+ * @brief Helper for iterating over elements of random access containers in element aggregations of parallel adapters.
+ *
+ * Elements are split into chunks processed by worker threads. When predicate of aggregation is not satisfied
+ * for some element then processing of other chunks is cancelled.
+ */
+template <typename AdapterT, typename ContainerT>
+struct aggregate_elements<AdapterT,ContainerT,
+        hana::when<
+            std::is_base_of<parallel_aggregation_tag,std::decay_t<decltype(traits_of(std::declval<AdapterT>()))>>::value
+            &&
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<decltype(std::declval<const ContainerT&>().begin())>::iterator_category
+            >::value
+        >>
+{
+    template <typename PredicateT, typename EmptyFnT, typename AdapterT1, typename HandlerT>
+    static status invoke(PredicateT&& pred, EmptyFnT&& empt, const ContainerT& container, AdapterT1& adapter, HandlerT&& handler)
+    {
+        const auto& traits=traits_of(adapter);
+        auto begin=container.begin();
+        size_t count=static_cast<size_t>(std::distance(begin,container.end()));
+        if (!traits.is_parallel(count))
+        {
+            return detail::aggregate_elements_sequentially(pred,empt,container,adapter,handler);
+        }
+
+        status ret;
+        auto make_handler=[&]()
+        {
+            return [&,chunk_adapter=adapter](size_t index) mutable
+            {
+                return status(handler(chunk_adapter,begin+index));
+            };
+        };
+        if (parallel_while_each(*traits.get_thread_pool(),count,traits.parallel_chunk_size(),pred,make_handler,ret))
+        {
+            return ret;
+        }
+        return empt(count==0);
+    }
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_PARALLEL_AGGREGATION_HPP
@@ -19,12 +19,22 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef DRACOSHA_VALIDATOR_TREE_HPP
 #define DRACOSHA_VALIDATOR_TREE_HPP
 
+#include <list>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <type_traits>
+
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/utils/adjust_storable_ignore.hpp>
+#include <dracosha/validator/utils/thread_pool.hpp>
 #include <dracosha/validator/get_member.hpp>
 #include <dracosha/validator/variadic_arg.hpp>
 #include <dracosha/validator/adapters/make_intermediate_adapter.hpp>
 #include <dracosha/validator/aggregation/aggregation.ipp>
+#include <dracosha/validator/aggregation/parallel_aggregation.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -102,59 +112,467 @@ constexpr tree_impl tree{};
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
 /**
- * @brief Process each tree node and iterate further.
- * @param tree_key Tree aggregation object used as a kay in member's path.
- * @param tmp_adapter Curent intermediate adapter.
+ * @brief Make adapter of a child node of a tree.
+ * @param tree_key Tree aggregation object used as a key in member's path.
+ * @param adapter Intermediate adapter of parent node.
+ * @param node Parent node.
+ * @param it Variadic "index" of child node.
+ * @return Intermediate adapter of child node.
+ *
+ * If getter of child nodes returns a value then the value is kept in the adapter.
+ */
+template <typename TreeKeyT, typename AdapterT, typename NodeT, typename IteratorT>
+auto make_tree_child_adapter(const TreeKeyT& tree_key, AdapterT& adapter, NodeT&& node, const IteratorT& it)
+{
+    return clone_intermediate_adapter(adapter,get_member(std::forward<NodeT>(node),hana::make_tuple(tree_key.property,varg(it))));
+}
+
+/**
+ * @brief Cancellation checker of sequential tree traversal that is never cancelled.
+ */
+struct tree_not_cancelled
+{
+    constexpr bool operator() () const noexcept
+    {
+        return false;
+    }
+};
+
+/**
+ * @brief Stack of tree traversal frames.
+ *
+ * The first frames are kept in place and the rest are allocated on heap only for deep trees.
+ * References to frames are not invalidated when other frames are pushed or popped.
+ */
+template <typename FrameT, size_t InplaceSize=32>
+class tree_traversal_stack
+{
+    public:
+
+        tree_traversal_stack()=default;
+        tree_traversal_stack(const tree_traversal_stack&)=delete;
+        tree_traversal_stack& operator= (const tree_traversal_stack&)=delete;
+
+        ~tree_traversal_stack()
+        {
+            while (!empty())
+            {
+                pop();
+            }
+        }
+
+        bool empty() const noexcept
+        {
+            return _size==0;
+        }
+
+        FrameT& top() noexcept
+        {
+            return _size>InplaceSize ? _overflow.back() : inplace(_size-1);
+        }
+
+        void push(FrameT&& frame)
+        {
+            if (_size<InplaceSize)
+            {
+                new (&_inplace[_size]) FrameT(std::move(frame));
+            }
+            else
+            {
+                _overflow.push_back(std::move(frame));
+            }
+            ++_size;
+        }
+
+        void pop() noexcept
+        {
+            --_size;
+            if (_size<InplaceSize)
+            {
+                inplace(_size).~FrameT();
+            }
+            else
+            {
+                _overflow.pop_back();
+            }
+        }
+
+    private:
+
+        FrameT& inplace(size_t index) noexcept
+        {
+            return *reinterpret_cast<FrameT*>(&_inplace[index]);
+        }
+
+        std::aligned_storage_t<sizeof(FrameT),alignof(FrameT)> _inplace[InplaceSize];
+        std::list<FrameT> _overflow;
+        size_t _size=0;
+};
+
+/**
+ * @brief Process descendants of a tree node using explicit stack instead of recursion.
+ * @param tree_key Tree aggregation object used as a key in member's path.
+ * @param adapter Intermediate adapter of the node, adapters of all descendants must be of the same type.
  * @param pred Logical predicate to be used for ALL/ANY aggregation.
  * @param handler Handler to invoke on each node.
  * @param used_path_size Length of already used member's path prefix.
  * @param path Member's path.
- * @param node Parent node.
- * @param aggregation_varg Variadic argument od the property that is used as getter of tree nodes.
- * @return Validation status.
+ * @param aggregation_varg Variadic argument of the property that is used as getter of tree nodes.
+ * @param cancelled Checker if traversal was cancelled.
+ * @return Validation status that broke the traversal or status::code::ignore.
+ */
+template <typename TreeKeyT, typename AdapterT, typename PredT, typename HandlerT, typename UsedPathSizeT,
+          typename PathT, typename VargT, typename CancelT>
+status each_tree_descendant(const TreeKeyT& tree_key, const AdapterT& adapter, const PredT& pred,
+                            const HandlerT& handler, const UsedPathSizeT& used_path_size,
+                            const PathT& path, const VargT& aggregation_varg, const CancelT& cancelled
+                            )
+{
+    using iterator_type=std::decay_t<decltype(aggregation_varg.begin(adapter.traits().value()))>;
+    struct frame
+    {
+        AdapterT adapter;
+        iterator_type it;
+    };
+
+    tree_traversal_stack<frame> stack;
+    auto top_adapter=adapter;
+    auto it=aggregation_varg.begin(top_adapter.traits().value());
+    stack.push(frame{std::move(top_adapter),it});
+    while (!stack.empty())
+    {
+        if (cancelled())
+        {
+            return status::code::ignore;
+        }
+
+        auto& top=stack.top();
+        auto&& node=top.adapter.traits().value();
+        if (!aggregation_varg.while_cond(node,top.it))
+        {
+            // all children of the node are processed
+            stack.pop();
+            continue;
+        }
+
+        // handle content of current child node itself
+        auto child_adapter=make_tree_child_adapter(tree_key,top.adapter,node,top.it);
+        aggregation_varg.next(node,top.it);
+        status ret=handler(child_adapter,path,used_path_size);
+        if (!pred(ret))
+        {
+            return ret;
+        }
+
+        // descend to children of current child node
+        auto child_it=aggregation_varg.begin(child_adapter.traits().value());
+        stack.push(frame{std::move(child_adapter),child_it});
+    }
+    return status::code::ignore;
+}
+
+/**
+ * @brief Process a tree node and all its descendants.
+ * @param tree_key Tree aggregation object used as a key in member's path.
+ * @param adapter Intermediate adapter of the node.
+ * @param pred Logical predicate to be used for ALL/ANY aggregation.
+ * @param handler Handler to invoke on each node.
+ * @param used_path_size Length of already used member's path prefix.
+ * @param path Member's path.
+ * @param aggregation_varg Variadic argument of the property that is used as getter of tree nodes.
+ * @param cancelled Checker if traversal was cancelled.
+ * @return Validation status that broke the traversal or status::code::ignore.
+ *
+ * Nodes are processed iteratively once types of adapters of parent and child nodes are the same,
+ * so that depth of a tree is not limited by the size of call stack.
+ */
+template <typename TreeKeyT, typename AdapterT, typename PredT, typename HandlerT, typename UsedPathSizeT,
+          typename PathT, typename VargT, typename CancelT>
+status each_tree_subtree(const TreeKeyT& tree_key, AdapterT& adapter, const PredT& pred,
+                         const HandlerT& handler, const UsedPathSizeT& used_path_size,
+                         const PathT& path, const VargT& aggregation_varg, const CancelT& cancelled
+                         )
+{
+    status ret=handler(adapter,path,used_path_size);
+    if (!pred(ret))
+    {
+        return ret;
+    }
+
+    auto&& node=adapter.traits().value();
+    using child_adapter_type=decltype(make_tree_child_adapter(tree_key,adapter,node,aggregation_varg.begin(node)));
+    return hana::eval_if(
+        std::is_same<child_adapter_type,AdapterT>{},
+        [&](auto&& _)
+        {
+            return each_tree_descendant(tree_key,_(adapter),pred,handler,used_path_size,path,aggregation_varg,cancelled);
+        },
+        [&](auto&& _)
+        {
+            auto&& parent=_(node);
+            for (auto it=aggregation_varg.begin(parent);
+                 aggregation_varg.while_cond(parent,it);
+                 aggregation_varg.next(parent,it)
+                )
+            {
+                auto child_adapter=make_tree_child_adapter(tree_key,_(adapter),parent,it);
+                status ret=each_tree_subtree(tree_key,child_adapter,pred,handler,used_path_size,path,aggregation_varg,cancelled);
+                if (!pred(ret))
+                {
+                    return ret;
+                }
+            }
+            return status{status::code::ignore};
+        }
+    );
+}
+
+/**
+ * @brief Process children of a tree node and their descendants sequentially.
  */
 template <typename TreeKeyT, typename AdapterT, typename PredT, typename HandlerT, typename UsedPathSizeT,
           typename PathT, typename NodeT, typename VargT>
-status each_tree_node(const TreeKeyT& tree_key, AdapterT& tmp_adapter, const PredT& pred,
-                      const HandlerT& handler, const UsedPathSizeT& used_path_size,
-                      const PathT& path, NodeT&& node, const VargT& aggregation_varg
-                      )
+status each_tree_node_sequentially(const TreeKeyT& tree_key, AdapterT& tmp_adapter, const PredT& pred,
+                                   const HandlerT& handler, const UsedPathSizeT& used_path_size,
+                                   const PathT& path, NodeT&& node, const VargT& aggregation_varg
+                                   )
 {
     for (auto it=aggregation_varg.begin(node);
          aggregation_varg.while_cond(node,it);
          aggregation_varg.next(node,it)
         )
     {
-        // handle content of current child node itself
-        auto&& child_node=get_member(node,hana::make_tuple(tree_key.property,varg(it)));
-        auto next_adapter=clone_intermediate_adapter(tmp_adapter,child_node);
-        status ret=handler(next_adapter,path,used_path_size);
+        auto next_adapter=make_tree_child_adapter(tree_key,tmp_adapter,node,it);
+        status ret=each_tree_subtree(tree_key,next_adapter,pred,handler,used_path_size,path,aggregation_varg,tree_not_cancelled{});
         if (!pred(ret))
         {
             return ret;
         }
+    }
+    return status::code::ignore;
+}
+
+/**
+ * @brief Process children of a tree node and their descendants in a thread pool.
+ * @param pool Thread pool.
+ *
+ * Subtrees are put to a shared queue of tasks that are picked up by worker threads and the calling thread.
+ * A worker processing a node adds subtrees of its children to the queue while the queue is short,
+ * otherwise the worker processes the subtrees itself sequentially. When predicate of aggregation
+ * is not satisfied for some node then processing of other subtrees is cancelled.
+ * Exception thrown by a handler cancels the traversal and is re-thrown in the calling thread.
+ */
+template <typename TreeKeyT, typename AdapterT, typename PredT, typename HandlerT, typename UsedPathSizeT,
+          typename PathT, typename NodeT, typename VargT>
+status each_tree_node_parallel(thread_pool& pool,
+                               const TreeKeyT& tree_key, AdapterT& tmp_adapter, const PredT& pred,
+                               const HandlerT& handler, const UsedPathSizeT& used_path_size,
+                               const PathT& path, NodeT&& node, const VargT& aggregation_varg
+                               )
+{
+    using task_type=decltype(make_tree_child_adapter(tree_key,tmp_adapter,node,aggregation_varg.begin(node)));
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<task_type> tasks;
+    std::atomic<bool> stop{false};
+    size_t active=0;
+    size_t running=0;
+    bool broken=false;
+    status result{status::code::ignore};
+    std::exception_ptr exception;
+    const size_t max_queued=2*pool.size()+2;
+
+    for (auto it=aggregation_varg.begin(node);
+         aggregation_varg.while_cond(node,it);
+         aggregation_varg.next(node,it)
+        )
+    {
+        tasks.push_back(make_tree_child_adapter(tree_key,tmp_adapter,node,it));
+    }
+    if (tasks.empty())
+    {
+        return status::code::ignore;
+    }
 
-        // recursive call for further iteration of children of current child node
-        ret=each_tree_node(
-                        tree_key,
-                        next_adapter,
-                        pred,
-                        handler,
-                        used_path_size,
-                        path,
-                        child_node,
-                        aggregation_varg
-                    );
+    auto cancelled=[&stop]()
+    {
+        return stop.load(std::memory_order_relaxed);
+    };
+    auto process=[&](task_type& task)
+    {
+        status ret=handler(task,path,used_path_size);
         if (!pred(ret))
         {
             return ret;
         }
 
-        // loop to handle next sibling child node
+        auto&& task_node=task.traits().value();
+        for (auto it=aggregation_varg.begin(task_node);
+             aggregation_varg.while_cond(task_node,it);
+             aggregation_varg.next(task_node,it)
+            )
+        {
+            if (cancelled())
+            {
+                break;
+            }
+
+            auto child_adapter=make_tree_child_adapter(tree_key,task,task_node,it);
+            bool queued=false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (tasks.size()<max_queued)
+                {
+                    tasks.push_back(std::move(child_adapter));
+                    queued=true;
+                }
+            }
+            if (queued)
+            {
+                cond.notify_one();
+                continue;
+            }
+
+            ret=each_tree_subtree(tree_key,child_adapter,pred,handler,used_path_size,path,aggregation_varg,cancelled);
+            if (!pred(ret))
+            {
+                return ret;
+            }
+        }
+        return status{status::code::ignore};
+    };
+    auto run=[&]()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            cond.wait(lock,[&](){return stop.load() || !tasks.empty() || active==0;});
+            if (stop.load() || tasks.empty())
+            {
+                // traversal is either cancelled or done
+                return;
+            }
+            auto task=std::move(tasks.back());
+            tasks.pop_back();
+            ++active;
+            lock.unlock();
+
+            try
+            {
+                status ret=process(task);
+                if (!pred(ret))
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    if (!broken && !exception)
+                    {
+                        broken=true;
+                        result=ret;
+                    }
+                    stop.store(true);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                if (!exception)
+                {
+                    exception=std::current_exception();
+                }
+                stop.store(true);
+            }
+
+            lock.lock();
+            if (--active==0 || stop.load())
+            {
+                cond.notify_all();
+            }
+        }
+    };
+
+    for (size_t i=0;i<pool.size();i++)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++running;
+        }
+        pool.post(
+            [&]()
+            {
+                run();
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--running==0)
+                {
+                    cond.notify_all();
+                }
+            }
+        );
     }
+    run();
 
-    return status::code::ignore;
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock,[&running](){return running==0;});
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+    return result;
+}
+
+}
+
+/**
+ * @brief Process each tree node and iterate further.
+ * @param tree_key Tree aggregation object used as a key in member's path.
+ * @param tmp_adapter Curent intermediate adapter.
+ * @param pred Logical predicate to be used for ALL/ANY aggregation.
+ * @param handler Handler to invoke on each node.
+ * @param used_path_size Length of already used member's path prefix.
+ * @param path Member's path.
+ * @param node Parent node.
+ * @param aggregation_varg Variadic argument od the property that is used as getter of tree nodes.
+ * @return Validation status.
+ *
+ * Tree is traversed depth-first using explicit stack. If adapter is a parallel adapter and getter of tree nodes
+ * returns references then subtrees are processed in a thread pool.
+ */
+template <typename TreeKeyT, typename AdapterT, typename PredT, typename HandlerT, typename UsedPathSizeT,
+          typename PathT, typename NodeT, typename VargT>
+status each_tree_node(const TreeKeyT& tree_key, AdapterT& tmp_adapter, const PredT& pred,
+                      const HandlerT& handler, const UsedPathSizeT& used_path_size,
+                      const PathT& path, NodeT&& node, const VargT& aggregation_varg
+                      )
+{
+    using child_type=decltype(get_member(node,hana::make_tuple(tree_key.property,varg(aggregation_varg.begin(node)))));
+    using child_adapter_type=decltype(detail::make_tree_child_adapter(tree_key,tmp_adapter,node,aggregation_varg.begin(node)));
+    using grandchild_adapter_type=decltype(detail::make_tree_child_adapter(tree_key,std::declval<child_adapter_type&>(),std::declval<child_type>(),aggregation_varg.begin(node)));
+
+    return hana::eval_if(
+        hana::bool_c<
+            std::is_base_of<parallel_aggregation_tag,std::decay_t<decltype(traits_of(tmp_adapter))>>::value
+            &&
+            std::is_lvalue_reference<child_type>::value
+            &&
+            std::is_same<child_adapter_type,grandchild_adapter_type>::value
+        >,
+        [&](auto&& _)
+        {
+            const auto& traits=traits_of(_(tmp_adapter));
+            if (traits.is_parallel())
+            {
+                return detail::each_tree_node_parallel(*traits.get_thread_pool(),tree_key,_(tmp_adapter),pred,handler,used_path_size,path,node,aggregation_varg);
+            }
+            return detail::each_tree_node_sequentially(tree_key,_(tmp_adapter),pred,handler,used_path_size,path,node,aggregation_varg);
+        },
+        [&](auto&& _)
+        {
+            return detail::each_tree_node_sequentially(tree_key,_(tmp_adapter),pred,handler,used_path_size,path,node,aggregation_varg);
+        }
+    );
 }
 
 /**
@@ -45,9 +45,10 @@ struct wrap_index_t : public AggregationT::type,
      * @param aggregation Element aggregation.
      */
     template <typename Ti, typename Ta>
-    wrap_index_t(Ti index, Ta&& aggregation)
+    wrap_index_t(Ti index, Ta&& aggregation, bool listed=false)
             : _index(std::move(index)),
-              _aggregation_type(std::forward<Ta>(aggregation))
+              _aggregation_type(std::forward<Ta>(aggregation)),
+              _listed(listed)
     {}
 
     auto aggregation() const -> decltype(auto)
@@ -57,7 +58,22 @@ struct wrap_index_t : public AggregationT::type,
 
     std::string name() const
     {
-        return _aggregation_type.name;
+        return hana::eval_if(
+            std::is_integral<T>{},
+            [&](auto&& _)
+            {
+                if (_listed)
+                {
+                    // the same phrase as used for integral keys of members
+                    return std::string("element #")+std::to_string(_(_index));
+                }
+                return std::string(_aggregation_type.name);
+            },
+            [&](auto&&)
+            {
+                return std::string(_aggregation_type.name);
+            }
+        );
     }
 
     template <typename T1>
@@ -90,6 +106,7 @@ struct wrap_index_t : public AggregationT::type,
 
         T _index;
         AggregationT _aggregation_type;
+        bool _listed;
 };
 
 /**
@@ -106,6 +123,23 @@ auto wrap_index(Ti&& it, Ta&& aggregation)
     };
 }
 
+/**
+ * @brief Wrap index for element aggregation and name it after the index.
+ * @param index Element's index to wrap.
+ * @param aggregation Element aggregation.
+ *
+ * Used to report each failed element of ALL aggregation in collect-all-failures mode.
+ */
+template <typename Ti, typename Ta>
+auto wrap_listed_index(Ti&& it, Ta&& aggregation)
+{
+    return wrap_index_t<std::decay_t<Ti>,std::decay_t<Ta>>{
+        std::forward<Ti>(it),
+        std::forward<Ta>(aggregation),
+        true
+    };
+}
+
 //-------------------------------------------------------------
 
 /**
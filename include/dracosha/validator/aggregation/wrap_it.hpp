@@ -50,7 +50,26 @@ struct wrap_it_t : public AggregationT::type,
     wrap_it_t(Ti&& it, Ta&& aggregation, Tm&& modifier)
             : _it(std::forward<Ti>(it)),
               _aggregation_type(std::forward<Ta>(aggregation)),
-              _modifier(std::forward<Tm>(modifier))
+              _modifier(std::forward<Tm>(modifier)),
+              _index(0),
+              _listed(false)
+    {}
+
+    /**
+      @brief Constructor of iterator that is named after the element it points to.
+      @param it Iterator.
+      @param aggregation Aggregation descriptor.
+      @param modifier Aggregation modifier.
+      @param index Index of the element in container.
+      @return Wrapped iterator.
+    */
+    template <typename Ti, typename Ta, typename Tm>
+    wrap_it_t(Ti&& it, Ta&& aggregation, Tm&& modifier, size_t index)
+            : _it(std::forward<Ti>(it)),
+              _aggregation_type(std::forward<Ta>(aggregation)),
+              _modifier(std::forward<Tm>(modifier)),
+              _index(index),
+              _listed(true)
     {}
 
     /**
@@ -87,6 +106,10 @@ struct wrap_it_t : public AggregationT::type,
      */
     std::string name() const
     {
+        if (_listed)
+        {
+            return element_name();
+        }
         return _aggregation_type(_modifier);
     }
 
@@ -113,9 +136,50 @@ struct wrap_it_t : public AggregationT::type,
 
     private:
 
+        /**
+         * @brief Get name of the element the iterator points to.
+         *
+         * Elements of associative containers are named after their keys, other elements are named after their indexes.
+         */
+        std::string element_name() const
+        {
+            using is_pair=is_pair_t<decltype(*_it)>;
+            using key_type=std::decay_t<decltype(key_it(_it))>;
+            return hana::eval_if(
+                hana::bool_c<is_pair::value && std::is_constructible<std::string,key_type>::value>,
+                [&](auto&& _)
+                {
+                    return std::string(key_it(_(_it)));
+                },
+                [&](auto&&)
+                {
+                    return hana::eval_if(
+                        hana::bool_c<is_pair::value && std::is_integral<key_type>::value>,
+                        [&](auto&& _)
+                        {
+                            return index_name(key_it(_(_it)));
+                        },
+                        [&](auto&& _)
+                        {
+                            return index_name(_(_index));
+                        }
+                    );
+                }
+            );
+        }
+
+        template <typename IndexT>
+        static std::string index_name(const IndexT& index)
+        {
+            // the same phrase as used for integral keys of members
+            return std::string("element #")+std::to_string(index);
+        }
+
         T _it;
         AggregationT _aggregation_type;
         ModifierT _modifier;
+        size_t _index;
+        bool _listed;
 };
 
 /**
@@ -135,6 +199,27 @@ auto wrap_it(Ti&& it, Ta&& aggregation, Tm&& modifier)
     };
 }
 
+/**
+  @brief Wrap iterator and name it after the element it points to.
+  @param it Iterator.
+  @param aggregation Aggregation descriptor.
+  @param modifier Aggregation modifier.
+  @param index Index of the element in container.
+  @return Wrapped iterator.
+
+  Used to report each failed element of ALL aggregation in collect-all-failures mode.
+  */
+template <typename Ti, typename Ta, typename Tm>
+auto wrap_listed_it(Ti&& it, Ta&& aggregation, Tm&& modifier, size_t index)
+{
+    return wrap_it_t<std::decay_t<Ti>,std::decay_t<Ta>,std::decay_t<Tm>>{
+        std::forward<Ti>(it),
+        std::forward<Ta>(aggregation),
+        std::forward<Tm>(modifier),
+        index
+    };
+}
+
 DRACOSHA_VALIDATOR_NAMESPACE_END
 
 #endif // DRACOSHA_VALIDATOR_WRAP_IT_HPP
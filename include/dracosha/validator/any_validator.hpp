@@ -0,0 +1,373 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/any_validator.hpp
+*
+*  Defines type-erased validator and arena for allocation of validators.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_ANY_VALIDATOR_HPP
+#define DRACOSHA_VALIDATOR_ANY_VALIDATOR_HPP
+
+#include <new>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/status.hpp>
+#include <dracosha/validator/validators.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Monotonic arena for allocation of validators.
+ *
+ * Memory is allocated in blocks and is released only when the arena is destroyed,
+ * so validators allocated in the same arena are placed next to each other.
+ * Arena must outlive all validators allocated in it. Arena is not thread safe.
+ */
+class validator_arena
+{
+    public:
+
+        /**
+         * @brief Default size of memory block.
+         */
+        constexpr static const size_t default_block_size=64*1024;
+
+        /**
+         * @brief Constructor.
+         * @param block_size Size of memory block.
+         */
+        explicit validator_arena(size_t block_size=default_block_size)
+            : _block_size(block_size),
+              _current(nullptr),
+              _left(0),
+              _allocated(0)
+        {}
+
+        ~validator_arena()=default;
+        validator_arena(const validator_arena&)=delete;
+        validator_arena(validator_arena&&)=delete;
+        validator_arena& operator= (const validator_arena&)=delete;
+        validator_arena& operator= (validator_arena&&)=delete;
+
+        /**
+         * @brief Allocate memory.
+         * @param size Size of memory.
+         * @param alignment Alignment of memory.
+         * @return Pointer to allocated memory.
+         */
+        void* allocate(size_t size, size_t alignment)
+        {
+            void* ptr=_current;
+            if (_current==nullptr || std::align(alignment,size,ptr,_left)==nullptr)
+            {
+                // objects larger than block are allocated in dedicated blocks
+                auto block_size=(std::max)(_block_size,size+alignment);
+                _blocks.emplace_back(new char[block_size]);
+                ptr=_blocks.back().get();
+                _left=block_size;
+                std::align(alignment,size,ptr,_left);
+            }
+            _current=static_cast<char*>(ptr)+size;
+            _left-=size;
+            _allocated+=size;
+            return ptr;
+        }
+
+        /**
+         * @brief Get size of memory allocated for objects.
+         * @return Allocated size.
+         */
+        size_t allocated() const noexcept
+        {
+            return _allocated;
+        }
+
+        /**
+         * @brief Get number of memory blocks.
+         * @return Number of blocks.
+         */
+        size_t block_count() const noexcept
+        {
+            return _blocks.size();
+        }
+
+    private:
+
+        size_t _block_size;
+        std::vector<std::unique_ptr<char[]>> _blocks;
+        char* _current;
+        size_t _left;
+        size_t _allocated;
+};
+
+/**
+ * @brief Default size of inline buffer of any_validator.
+ */
+constexpr const size_t default_any_validator_buffer_size=64;
+
+/**
+ * @brief Type-erased validator for adapters of certain type.
+ *
+ * Validators that fit into inline buffer and can be moved without exceptions are stored in the buffer,
+ * other validators are allocated either on heap or in validator_arena. Applying any_validator is a single indirect call.
+ *
+ * any_validator can be moved but can not be copied, so it can be stored in vectors and other containers.
+ * Empty any_validator ignores validation.
+ *
+ * @tparam AdapterT Type of adapter to apply validator to.
+ * @tparam BufferSize Size of inline buffer.
+ */
+template <typename AdapterT, size_t BufferSize=default_any_validator_buffer_size>
+class any_validator
+{
+    public:
+
+        using adapter_type=AdapterT;
+
+        /**
+         * @brief Check if validator of given type can be stored in inline buffer.
+         */
+        template <typename ValidatorT>
+        using is_inline_validator=std::integral_constant<bool,
+                sizeof(ValidatorT)<=BufferSize
+                &&
+                alignof(ValidatorT)<=alignof(std::max_align_t)
+                &&
+                std::is_nothrow_move_constructible<ValidatorT>::value
+            >;
+
+        /**
+         * @brief Default constructor of empty validator.
+         */
+        any_validator() noexcept
+            : _apply(&apply_empty),
+              _manage(nullptr),
+              _object(nullptr)
+        {}
+
+        /**
+         * @brief Constructor.
+         * @param v Validator to wrap.
+         *
+         * Validator is stored in inline buffer if possible, otherwise it is allocated on heap.
+         */
+        template <typename ValidatorT,
+                  typename=std::enable_if_t<hana::is_a<validator_tag,ValidatorT>>>
+        any_validator(ValidatorT&& v)
+            : any_validator()
+        {
+            emplace(std::forward<ValidatorT>(v),nullptr);
+        }
+
+        /**
+         * @brief Constructor with arena.
+         * @param v Validator to wrap.
+         * @param arena Arena to allocate validator in if it does not fit into inline buffer.
+         */
+        template <typename ValidatorT,
+                  typename=std::enable_if_t<hana::is_a<validator_tag,ValidatorT>>>
+        any_validator(ValidatorT&& v, validator_arena& arena)
+            : any_validator()
+        {
+            emplace(std::forward<ValidatorT>(v),&arena);
+        }
+
+        ~any_validator()
+        {
+            reset();
+        }
+
+        any_validator(const any_validator&)=delete;
+        any_validator& operator= (const any_validator&)=delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        any_validator(any_validator&& other) noexcept
+            : any_validator()
+        {
+            move_from(other);
+        }
+
+        /**
+         * @brief Move assignment.
+         */
+        any_validator& operator= (any_validator&& other) noexcept
+        {
+            if (this!=&other)
+            {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Apply validator.
+         * @param adapter Adapter wrapping object to validate.
+         * @return Validation status.
+         */
+        status apply(AdapterT& adapter) const
+        {
+            return _apply(_object,adapter);
+        }
+
+        /**
+         * @brief Check if validator is empty.
+         * @return Result of checking.
+         */
+        bool empty() const noexcept
+        {
+            return _manage==nullptr;
+        }
+
+        /**
+         * @brief Check if validator is stored in inline buffer.
+         * @return Result of checking.
+         */
+        bool is_inline() const noexcept
+        {
+            return _object==static_cast<const void*>(&_buffer);
+        }
+
+        /**
+         * @brief Destroy wrapped validator.
+         */
+        void reset() noexcept
+        {
+            if (_manage!=nullptr)
+            {
+                _manage(operation::destroy,this,nullptr);
+                _apply=&apply_empty;
+                _manage=nullptr;
+                _object=nullptr;
+            }
+        }
+
+    private:
+
+        enum class operation : int
+        {
+            move,
+            destroy
+        };
+
+        using apply_fn=status (*)(const void*,AdapterT&);
+        using manage_fn=void (*)(operation,any_validator*,any_validator*);
+
+        static status apply_empty(const void*, AdapterT&)
+        {
+            return status{status::code::ignore};
+        }
+
+        template <typename ValidatorT>
+        static status apply_validator(const void* v, AdapterT& adapter)
+        {
+            return static_cast<const ValidatorT*>(v)->apply(adapter);
+        }
+
+        template <typename ValidatorT>
+        static void manage_inline(operation op, any_validator* self, any_validator* to) noexcept
+        {
+            auto v=static_cast<ValidatorT*>(self->_object);
+            if (op==operation::move)
+            {
+                to->_object=::new (static_cast<void*>(&to->_buffer)) ValidatorT(std::move(*v));
+            }
+            v->~ValidatorT();
+        }
+
+        template <typename ValidatorT>
+        static void manage_heap(operation op, any_validator* self, any_validator* to) noexcept
+        {
+            if (op==operation::move)
+            {
+                to->_object=self->_object;
+                return;
+            }
+            delete static_cast<ValidatorT*>(self->_object);
+        }
+
+        template <typename ValidatorT>
+        static void manage_arena(operation op, any_validator* self, any_validator* to) noexcept
+        {
+            if (op==operation::move)
+            {
+                to->_object=self->_object;
+                return;
+            }
+            // memory is released by arena
+            static_cast<ValidatorT*>(self->_object)->~ValidatorT();
+        }
+
+        template <typename ValidatorT>
+        void emplace(ValidatorT&& v, validator_arena* arena)
+        {
+            using type=std::decay_t<ValidatorT>;
+            hana::eval_if(
+                is_inline_validator<type>{},
+                [&](auto&& _)
+                {
+                    _object=::new (static_cast<void*>(&_buffer)) type(std::forward<ValidatorT>(_(v)));
+                    _manage=&manage_inline<type>;
+                },
+                [&](auto&& _)
+                {
+                    if (arena!=nullptr)
+                    {
+                        auto ptr=arena->allocate(sizeof(type),alignof(type));
+                        _object=::new (ptr) type(std::forward<ValidatorT>(_(v)));
+                        _manage=&manage_arena<type>;
+                    }
+                    else
+                    {
+                        _object=new type(std::forward<ValidatorT>(_(v)));
+                        _manage=&manage_heap<type>;
+                    }
+                }
+            );
+            _apply=&apply_validator<type>;
+        }
+
+        void move_from(any_validator& other) noexcept
+        {
+            if (other._manage!=nullptr)
+            {
+                other._manage(operation::move,&other,this);
+                _apply=other._apply;
+                _manage=other._manage;
+                other._apply=&apply_empty;
+                other._manage=nullptr;
+                other._object=nullptr;
+            }
+        }
+
+        apply_fn _apply;
+        manage_fn _manage;
+        void* _object;
+        typename std::aligned_storage<BufferSize,alignof(std::max_align_t)>::type _buffer;
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_ANY_VALIDATOR_HPP
@@ -39,7 +39,7 @@ status apply_generated_paths_impl::operator () (UsedPathSizeT&& used_path_size,
         },
         [&](auto&& _)
         {
-            auto&& key=wrap_object_ref(hana::at(_(member).path(),_(used_path_size)));
+            auto&& key=wrap_key_ref(hana::at(_(member).path(),_(used_path_size)));
             return generate_paths<std::decay_t<decltype(key)>>(
                         hana::plus(_(used_path_size),hana::size_c<1>),
                         hana::append(_(current_path),std::move(key)),
@@ -132,14 +132,14 @@ bool paths_equal(const T1& path1, const T2& path2)
         same_path_types(path1,path2),
         [&](auto&& _)
         {
-            auto pairs=hana::zip(_(path1),_(path2));
+            // compare keys in place by indexes, hana::zip would copy the keys
             return while_each(
-                                  pairs,
+                                  hana::to_tuple(hana::make_range(hana::size_c<0>,hana::size(_(path1)))),
                                   predicate_and,
                                   true,
-                                  [](auto&& pair)
+                                  [&](auto index)
                                   {
-                                    return safe_compare_equal(unwrap_object(hana::front(pair)),unwrap_object(hana::back(pair)));
+                                    return safe_compare_equal(unwrap_object(hana::at(_(path1),index)),unwrap_object(hana::at(_(path2),index)));
                                   }
                               );
         },
@@ -0,0 +1,421 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/compile.hpp
+*
+*  Defines compile() that lowers validator into a flat program of checks.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_COMPILE_HPP
+#define DRACOSHA_VALIDATOR_COMPILE_HPP
+
+#include <array>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/status.hpp>
+#include <dracosha/validator/apply.hpp>
+#include <dracosha/validator/lazy.hpp>
+#include <dracosha/validator/base_validator.hpp>
+#include <dracosha/validator/validators.hpp>
+#include <dracosha/validator/filter_member.hpp>
+#include <dracosha/validator/utils/conditional_fold.hpp>
+#include <dracosha/validator/aggregation/aggregation.hpp>
+#include <dracosha/validator/detail/aggregate_and.hpp>
+#include <dracosha/validator/adapters/default_adapter.hpp>
+#include <dracosha/validator/adapters/make_intermediate_adapter.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Check if validator is a logical AND of other validators.
+ */
+template <typename T>
+struct is_and_validator : public std::false_type
+{};
+
+/**
+ * @brief Check if validator is a logical AND of other validators.
+ *
+ * Specialization for validators constructed with AND.
+ */
+template <typename OpsT, typename WithCheckExistsT, typename BaseExistsOperatorT, typename ExistsOperatorT>
+struct is_and_validator<
+            validator_t<
+                base_validator<aggregation_handler<aggregate_and_t,OpsT>,WithCheckExistsT,BaseExistsOperatorT>,
+                ExistsOperatorT
+            >
+        > : public std::true_type
+{};
+
+/**
+ * @brief Implementer of flatten_and().
+ */
+struct flatten_and_impl
+{
+    template <typename T>
+    auto operator() (const T& v) const
+    {
+        return hana::eval_if(
+            is_and_validator<T>{},
+            [&](auto&& _)
+            {
+                return hana::flatten(hana::transform(_(v).handler().fn.ops,*this));
+            },
+            [&](auto&& _)
+            {
+                return hana::make_tuple(_(v));
+            }
+        );
+    }
+};
+/**
+ * @brief Get flat list of validators of nested logical ANDs.
+ * @param v Validator.
+ * @return Tuple of validators that are not ANDs, if validator is not AND then tuple of the validator itself.
+ */
+constexpr flatten_and_impl flatten_and{};
+
+/**
+ * @brief Check if validator is a member validator whose member can be fetched once for a group of validators.
+ */
+template <typename T, typename=hana::when<true>>
+struct is_groupable_member_validator : public std::false_type
+{};
+
+/**
+ * @brief Check if validator is a member validator whose member can be fetched once for a group of validators.
+ *
+ * Members with aggregations in paths and validators that check existence of member are not grouped.
+ */
+template <typename MemberT, typename ValidatorT, typename ExistsOperatorT>
+struct is_groupable_member_validator<
+            validator_with_member_t<MemberT,ValidatorT,ExistsOperatorT>,
+            hana::when<
+                !MemberT::is_aggregated::value
+                &&
+                !std::decay_t<ValidatorT>::with_check_exists::value
+            >
+        > : public std::true_type
+{
+    using member_type=MemberT;
+};
+
+/**
+ * @brief Check if member validator can join the group of previous member validator.
+ */
+template <typename PreviousT, typename CurrentT, typename=hana::when<true>>
+struct can_join_member_group : public std::false_type
+{};
+
+/**
+ * @brief Check if member validator can join the group of previous member validator.
+ *
+ * Validator can join the group if both validators are groupable member validators with members of the same type.
+ */
+template <typename PreviousT, typename CurrentT>
+struct can_join_member_group<PreviousT,CurrentT,
+            hana::when<
+                is_groupable_member_validator<PreviousT>::value
+                &&
+                is_groupable_member_validator<CurrentT>::value
+            >
+        > : public std::is_same<
+                typename is_groupable_member_validator<PreviousT>::member_type,
+                typename is_groupable_member_validator<CurrentT>::member_type
+            >
+{};
+
+/**
+ * @brief Check if validator at some index of a list can join the group of validator at previous index.
+ */
+template <typename OpsT, size_t Index,
+          bool InRange=(Index>0 && Index<decltype(hana::size(std::declval<OpsT>()))::value)>
+struct can_join_group : public std::false_type
+{};
+
+/**
+ * @brief Check if validator at some index of a list can join the group of validator at previous index.
+ *
+ * Specialization for indexes in range [1,size).
+ */
+template <typename OpsT, size_t Index>
+struct can_join_group<OpsT,Index,true>
+        : public can_join_member_group<
+                std::decay_t<decltype(hana::at_c<Index-1>(std::declval<OpsT>()))>,
+                std::decay_t<decltype(hana::at_c<Index>(std::declval<OpsT>()))>
+            >
+{};
+
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Validator lowered into a flat program of checks.
+ *
+ * Nested logical ANDs are folded into a single list of checks. Adjacent checks of the same member
+ * are grouped so that the member is looked up and its existence is checked only once for the whole group,
+ * then each check of the group is invoked on the already fetched member's value.
+ *
+ * The program is executed only with adapters that are implemented on top of default adapter, e.g.
+ * default adapter or parallel adapter. Other adapters, e.g. reporting adapter, use the original validator,
+ * so that reports are exactly the same as if the validator was not compiled.
+ */
+template <typename ValidatorT>
+class compiled_validator
+{
+    public:
+
+        using hana_tag=validator_tag;
+        using with_check_exists=typename ValidatorT::with_check_exists;
+        using exists_operator_type=std::decay_t<decltype(std::declval<ValidatorT>().exists_operator)>;
+
+        const bool check_exists_operand;
+        const exists_operator_type& exists_operator;
+
+        /**
+         * @brief Constructor.
+         * @param validator Original validator.
+         */
+        explicit compiled_validator(ValidatorT validator)
+            : check_exists_operand(validator.check_exists_operand),
+              exists_operator(validator.exists_operator),
+              _validator(std::move(validator)),
+              _ops(detail::flatten_and(_validator)),
+              _joined{}
+        {
+            hana::for_each(
+                hana::make_range(hana::size_c<0>,hana::size_c<ops_count>),
+                [this](auto index)
+                {
+                    hana::eval_if(
+                        detail::can_join_group<ops_type,decltype(index)::value>{},
+                        [&](auto&& _)
+                        {
+                            const auto& current=hana::at(_(_ops),_(index));
+                            const auto& previous=hana::at(_(_ops),hana::minus(_(index),hana::size_c<1>));
+                            _joined[index]=current.member().equals(previous.member());
+                        },
+                        [](auto&&)
+                        {}
+                    );
+                }
+            );
+        }
+
+        /**
+         * @brief Apply validation to adapter.
+         * @param adpt Adapter or object to validate.
+         * @return Validation status.
+         */
+        template <typename AdapterT>
+        status apply(AdapterT&& adpt) const
+        {
+            // flat program does not pass through apply() of validators, so it opens validation pass for lazy operands itself
+            detail::lazy_pass_scope scope;
+            auto&& adapter=ensure_adapter(std::forward<AdapterT>(adpt));
+            using traits_type=std::decay_t<decltype(traits_of(adapter))>;
+            return hana::eval_if(
+                std::is_base_of<default_adapter_impl,traits_type>{},
+                [&](auto&& _)
+                {
+                    // flat program stops at the first failure, so collect-all-failures mode is handled by the original validator
+                    if (is_collect_all_failures(_(adapter)))
+                    {
+                        return status(_validator.apply(_(adapter)));
+                    }
+                    return run(_(adapter));
+                },
+                [&](auto&& _)
+                {
+                    return status(_validator.apply(_(adapter)));
+                }
+            );
+        }
+
+        /**
+         * @brief Apply validation to adapter with additional arguments, e.g. when validator is nested into member.
+         * @param adpt Adapter or object to validate.
+         * @param args Arguments to forward to the original validator.
+         * @return Validation status.
+         */
+        template <typename AdapterT, typename Arg1, typename ... Args>
+        status apply(AdapterT&& adpt, Arg1&& arg1, Args&&... args) const
+        {
+            return status(_validator.apply(std::forward<AdapterT>(adpt),std::forward<Arg1>(arg1),std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Get original validator.
+         * @return Validator that was compiled.
+         */
+        const ValidatorT& original() const noexcept
+        {
+            return _validator;
+        }
+
+        /**
+         * @brief Get number of checks in the program.
+         * @return Number of checks after folding of nested ANDs.
+         */
+        constexpr static size_t size() noexcept
+        {
+            return ops_count;
+        }
+
+        /**
+         * @brief Get number of groups of checks in the program.
+         * @return Number of groups where each group either is a single check or checks of the same member.
+         */
+        size_t group_count() const noexcept
+        {
+            size_t count=0;
+            for (auto joined:_joined)
+            {
+                if (!joined)
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+    private:
+
+        using ops_type=std::decay_t<decltype(detail::flatten_and(std::declval<const ValidatorT&>()))>;
+        constexpr static const size_t ops_count=decltype(hana::size(std::declval<ops_type>()))::value;
+
+        template <typename AdapterT>
+        status run(AdapterT&& adapter) const
+        {
+            return while_each(
+                        hana::to_tuple(hana::make_range(hana::size_c<0>,hana::size_c<ops_count>)),
+                        predicate_and,
+                        status(status::code::ignore),
+                        status(status::code::ignore),
+                        [this,&adapter](const status& state, auto index)
+                        {
+                            if (_joined[index])
+                            {
+                                // check was already invoked within the group of previous check
+                                return state;
+                            }
+                            return run_group(adapter,index);
+                        }
+                    );
+        }
+
+        template <typename AdapterT, typename IndexT>
+        status run_group(AdapterT&& adapter, IndexT index) const
+        {
+            constexpr const size_t next=IndexT::value+1;
+            return hana::eval_if(
+                detail::can_join_group<ops_type,next>{},
+                [&](auto&& _)
+                {
+                    if (_joined[next])
+                    {
+                        return invoke_group(_(adapter),_(index));
+                    }
+                    return status(DRACOSHA_VALIDATOR_NAMESPACE::apply(_(adapter),hana::at(_ops,_(index))));
+                },
+                [&](auto&& _)
+                {
+                    return status(DRACOSHA_VALIDATOR_NAMESPACE::apply(_(adapter),hana::at(_ops,_(index))));
+                }
+            );
+        }
+
+        template <typename AdapterT, typename IndexT>
+        status invoke_group(AdapterT&& adapter, IndexT index) const
+        {
+            auto fn=[this](auto&& adapter, auto&& member)
+            {
+                // fetch member only once and then invoke all checks of the group on the member's value
+                auto tmp_adapter=make_intermediate_adapter(adapter,member.path());
+                bool in_group=true;
+                return while_each(
+                            hana::to_tuple(hana::make_range(hana::size_c<IndexT::value>,hana::size_c<ops_count>)),
+                            predicate_and,
+                            status(status::code::ignore),
+                            status(status::code::ignore),
+                            [&](const status& state, auto current)
+                            {
+                                using current_type=decltype(current);
+                                return hana::eval_if(
+                                    hana::bool_c<
+                                        current_type::value==IndexT::value
+                                        ||
+                                        detail::can_join_group<ops_type,current_type::value>::value
+                                    >,
+                                    [&](auto&& _)
+                                    {
+                                        if (!in_group || (current_type::value!=IndexT::value && !_joined[current_type::value]))
+                                        {
+                                            in_group=false;
+                                            return state;
+                                        }
+                                        return status(
+                                                    apply_member(
+                                                        tmp_adapter,
+                                                        hana::at_c<current_type::value>(_(_ops)).prepared_validator(),
+                                                        member
+                                                    )
+                                                );
+                                    },
+                                    [&](auto&&)
+                                    {
+                                        in_group=false;
+                                        return state;
+                                    }
+                                );
+                            }
+                        );
+            };
+            auto validator=base_validator<decltype(fn)>{std::move(fn)};
+            return filter_member(validator,adapter,hana::at(_ops,index).member());
+        }
+
+        ValidatorT _validator;
+        ops_type _ops;
+        std::array<bool,ops_count> _joined;
+};
+
+/**
+ * @brief Implementer of compile().
+ */
+struct compile_impl
+{
+    template <typename ValidatorT>
+    auto operator() (ValidatorT&& validator) const
+    {
+        return compiled_validator<std::decay_t<ValidatorT>>(std::forward<ValidatorT>(validator));
+    }
+};
+/**
+ * @brief Compile validator into a flat program of checks.
+ * @param validator Validator.
+ * @return Compiled validator that can be used everywhere the original validator can be used.
+ */
+constexpr compile_impl compile{};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_COMPILE_HPP
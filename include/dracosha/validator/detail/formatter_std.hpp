@@ -10,7 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 /** @file validator/detail/formatter_std.hpp
 *
-*  Defines formatter that uses std::stringstream for strings formatting.
+*  Defines formatter that appends strings directly to destination and uses std::ostringstream for formatting of other values.
 *
 */
 
@@ -21,8 +21,11 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <string>
 #include <sstream>
+#include <algorithm>
 
 #include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/optional.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
 #include <dracosha/validator/utils/reference_wrapper.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
@@ -32,6 +35,120 @@ DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 namespace detail
 {
 
+/**
+ * @brief Check if value can be appended to string as a string view.
+ */
+template <typename T>
+using is_std_append_string=std::integral_constant<bool,
+        std::is_constructible<string_view,const T&>::value
+        &&
+        !std::is_base_of<adjust_view_ignore,T>::value
+    >;
+
+/**
+ * @brief Helper for appending values directly to the end of destination string.
+ *
+ * Strings and chars are appended as is. Other values are formatted with std::ostringstream
+ * that is constructed only once per appender when it is needed for the first time.
+ */
+class std_appender
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param dst Destination string.
+         */
+        explicit std_appender(std::string& dst) : _dst(dst)
+        {}
+
+        /**
+         * @brief Append value to destination string.
+         * @param v Value.
+         */
+        template <typename T>
+        void operator() (const T& v)
+        {
+            append(v,is_std_append_string<T>{});
+        }
+
+        /**
+         * @brief Reserve space in destination string before appending.
+         * @param size Number of chars to be appended.
+         *
+         * Capacity of destination string grows at least twice to keep appending linear.
+         */
+        void reserve(size_t size)
+        {
+            auto required=_dst.size()+size;
+            if (required>_dst.capacity())
+            {
+                _dst.reserve(std::max(required,2*_dst.capacity()));
+            }
+        }
+
+        /**
+         * @brief Get size of value if it is known before formatting.
+         * @param v Value.
+         * @return Size of value if it is a string or char, otherwise 0.
+         */
+        template <typename T>
+        static size_t size_hint(const T& v)
+        {
+            return size_hint(v,is_std_append_string<T>{});
+        }
+
+    private:
+
+        template <typename T>
+        void append(const T& v, std::true_type)
+        {
+            string_view str(v);
+            _dst.append(str.data(),str.size());
+        }
+
+        void append(char v, std::false_type)
+        {
+            _dst.push_back(v);
+        }
+
+        template <typename T>
+        void append(const T& v, std::false_type)
+        {
+            if (!_stream)
+            {
+                _stream.emplace();
+            }
+            else
+            {
+                _stream->str(std::string());
+                _stream->clear();
+            }
+            *_stream<<v;
+            _dst.append(_stream->str());
+        }
+
+        template <typename T>
+        static size_t size_hint(const T& v, std::true_type)
+        {
+            return string_view(v).size();
+        }
+
+        static size_t size_hint(char, std::false_type)
+        {
+            return 1;
+        }
+
+        template <typename T>
+        static size_t size_hint(const T&, std::false_type)
+        {
+            return 0;
+        }
+
+        std::string& _dst;
+        optional<std::ostringstream> _stream;
+};
+
 /**
  * @brief Append arguments to destination string.
  * @param dst Destination string.
@@ -42,18 +159,30 @@ template <typename PartsT, typename SepT>
 void std_append_join(std::string& dst, SepT&& sep, PartsT&& parts,
                      std::enable_if_t<!hana::is_a<hana::tuple_tag,PartsT>,void*> =nullptr)
 {
+    std_appender appender(dst);
+
+    size_t size=0;
+    size_t count=0;
+    for (auto&& it:parts)
+    {
+        size+=std_appender::size_hint(it);
+        ++count;
+    }
+    if (count>1)
+    {
+        size+=(count-1)*std_appender::size_hint(sep);
+    }
+    appender.reserve(size);
+
     size_t i=0;
-    std::stringstream ss;
-    ss<<dst;
     for (auto&& it:parts)
     {
         if (i++!=0)
         {
-            ss<<sep;
+            appender(sep);
         }
-        ss<<it;
+        appender(it);
     }
-    dst=ss.str();
 }
 
 /**
@@ -66,22 +195,36 @@ template <typename PartsT, typename SepT>
 void std_append_join(std::string& dst, SepT&& sep, PartsT&& parts,
                      std::enable_if_t<hana::is_a<hana::tuple_tag,PartsT>,void*> =nullptr)
 {
-    std::stringstream ss;
-    ss<<dst;
+    std_appender appender(dst);
+
+    auto size=hana::fold(
+        parts,
+        size_t(0),
+        [](size_t size, auto&& v)
+        {
+            return size+std_appender::size_hint(extract_ref(v));
+        }
+    );
+    constexpr const size_t count=decltype(hana::size(parts))::value;
+    if (count>1)
+    {
+        size+=(count-1)*std_appender::size_hint(sep);
+    }
+    appender.reserve(size);
+
     hana::fold(
         std::forward<PartsT>(parts),
         0u,
-        [&ss,&sep](size_t i,auto&& v)
+        [&appender,&sep](size_t i,auto&& v)
         {
             if (i!=0u)
             {
-                ss<<sep;
+                appender(sep);
             }
-            ss<<extract_ref(std::forward<decltype(v)>(v));
+            appender(extract_ref(std::forward<decltype(v)>(v)));
             return i+1;
         }
     );
-    dst=ss.str();
 }
 
 /**
@@ -99,7 +242,7 @@ void std_append(std::string& dst, SepT&& sep, Args&&... args)
 struct backend_formatter_tag;
 
 /**
- * @brief Backend formatter that uses std::stringstream fot formatting.
+ * @brief Backend formatter that appends to std::string and uses std::ostringstream for formatting of non-string values.
  */
 struct std_backend_formatter
 {
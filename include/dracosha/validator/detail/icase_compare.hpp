@@ -0,0 +1,205 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/detail/icase_compare.hpp
+*
+*  Defines case insensitive comparison of strings with fast path for ASCII characters.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_ICASE_COMPARE_HPP
+#define DRACOSHA_VALIDATOR_ICASE_COMPARE_HPP
+
+#include <locale>
+#include <algorithm>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/detail/string_scanners.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Fold character to upper case.
+ *
+ * ASCII characters are folded without branches, other characters are folded with std::toupper of global locale
+ * the same way as boost::algorithm case insensitive functions do.
+ * If DRACOSHA_VALIDATOR_ICASE_LOCALE is defined then all characters are folded with the global locale.
+ */
+inline char icase_fold(char ch)
+{
+    auto uch=static_cast<unsigned char>(ch);
+#ifndef DRACOSHA_VALIDATOR_ICASE_LOCALE
+    if (uch<0x80)
+    {
+        return static_cast<char>(uch^(static_cast<unsigned>(static_cast<unsigned char>(uch-'a')<26u)<<5));
+    }
+#endif
+    return std::use_facet<std::ctype<char>>(std::locale()).toupper(ch);
+}
+
+#ifdef DRACOSHA_VALIDATOR_SCANNERS_SSE2
+
+/**
+ * @brief Get mask of bytes that are equal in two SSE2 vectors after folding to upper case.
+ * @param ascii Set to false if any of vectors contains non-ASCII bytes, in this case the mask must not be used.
+ * @return Mask of equal bytes.
+ */
+inline uint32_t sse2_icase_equal_mask(const char* a, const char* b, bool& ascii) noexcept
+{
+    auto va=_mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+    auto vb=_mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    ascii=_mm_movemask_epi8(_mm_or_si128(va,vb))==0;
+    auto case_bit=_mm_set1_epi8(0x20);
+    auto fa=_mm_xor_si128(va,_mm_and_si128(sse2_in_range(va,'a','z'),case_bit));
+    auto fb=_mm_xor_si128(vb,_mm_and_si128(sse2_in_range(vb,'a','z'),case_bit));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(fa,fb)));
+}
+
+#endif
+
+/**
+ * @brief Find the first position in range [from,to) where characters of two strings differ when folded to upper case.
+ */
+inline size_t icase_mismatch_scalar(const char* a, const char* b, size_t from, size_t to)
+{
+    for (size_t i=from;i<to;i++)
+    {
+        if (a[i]!=b[i] && icase_fold(a[i])!=icase_fold(b[i]))
+        {
+            return i;
+        }
+    }
+    return to;
+}
+
+/**
+ * @brief Find the first position where characters of two strings differ when folded to upper case.
+ * @param a First string.
+ * @param b Second string.
+ * @param size Number of characters to compare.
+ * @return Position of the first mismatch or size if all characters match.
+ *
+ * Blocks of ASCII characters are compared with SSE2 if available, blocks containing non-ASCII characters
+ * are compared character by character.
+ */
+inline size_t icase_mismatch(const char* a, const char* b, size_t size)
+{
+    size_t i=0;
+#if defined(DRACOSHA_VALIDATOR_SCANNERS_SSE2) && !defined(DRACOSHA_VALIDATOR_ICASE_LOCALE)
+    for (;i+16<=size;i+=16)
+    {
+        bool ascii=false;
+        auto mask=sse2_icase_equal_mask(a+i,b+i,ascii);
+        if (ascii)
+        {
+            if (mask!=0xFFFFu)
+            {
+                return i+count_trailing_zeros(~mask);
+            }
+        }
+        else
+        {
+            auto pos=icase_mismatch_scalar(a,b,i,i+16);
+            if (pos!=i+16)
+            {
+                return pos;
+            }
+        }
+    }
+#endif
+    return icase_mismatch_scalar(a,b,i,size);
+}
+
+/**
+ * @brief Compare strings case insensitively.
+ * @return True if strings are equal.
+ */
+inline bool icase_equals(string_view a, string_view b)
+{
+    return a.size()==b.size() && icase_mismatch(a.data(),b.data(),a.size())==a.size();
+}
+
+/**
+ * @brief Check if the first string is case insensitively less than the second string.
+ *
+ * Folded characters are compared as values of type char, the same way as in boost::algorithm::ilexicographical_compare().
+ */
+inline bool icase_less(string_view a, string_view b)
+{
+    auto size=(std::min)(a.size(),b.size());
+    auto pos=icase_mismatch(a.data(),b.data(),size);
+    if (pos==size)
+    {
+        return a.size()<b.size();
+    }
+    return icase_fold(a[pos])<icase_fold(b[pos]);
+}
+
+/**
+ * @brief Check if string case insensitively starts with prefix.
+ */
+inline bool icase_starts_with(string_view str, string_view prefix)
+{
+    return str.size()>=prefix.size() && icase_mismatch(str.data(),prefix.data(),prefix.size())==prefix.size();
+}
+
+/**
+ * @brief Check if string case insensitively ends with suffix.
+ */
+inline bool icase_ends_with(string_view str, string_view suffix)
+{
+    return str.size()>=suffix.size()
+            &&
+           icase_mismatch(str.data()+str.size()-suffix.size(),suffix.data(),suffix.size())==suffix.size();
+}
+
+/**
+ * @brief Check if string case insensitively contains substring.
+ */
+inline bool icase_contains(string_view str, string_view substr)
+{
+    if (substr.empty())
+    {
+        return true;
+    }
+    if (str.size()<substr.size())
+    {
+        return false;
+    }
+    auto first=icase_fold(substr[0]);
+    auto last=str.size()-substr.size();
+    for (size_t i=0;i<=last;i++)
+    {
+        if (icase_fold(str[i])==first
+            &&
+            icase_mismatch(str.data()+i+1,substr.data()+1,substr.size()-1)==substr.size()-1
+           )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//-------------------------------------------------------------
+
+}
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_ICASE_COMPARE_HPP
@@ -0,0 +1,174 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/detail/member_path_key.hpp
+*
+*  Defines helpers for making binary keys of member paths used by caches and indexes.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_MEMBER_PATH_KEY_HPP
+#define DRACOSHA_VALIDATOR_MEMBER_PATH_KEY_HPP
+
+#include <string>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/property.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/utils/unwrap_object.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+struct wrap_iterator_tag;
+struct wrap_index_tag;
+
+namespace detail
+{
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Check if key of member path is a key of element aggregation.
+ */
+template <typename T>
+using is_element_aggregation_key=std::integral_constant<bool,
+        hana::is_a<wrap_iterator_tag,T>
+        ||
+        hana::is_a<wrap_index_tag,T>
+    >;
+
+/**
+ * @brief Default helper for appending a key of member path to binary key, used for keys that can not be appended.
+ */
+template <typename T, typename =hana::when<true>>
+struct member_path_key_t
+{
+    bool operator() (std::string&, const T&) const noexcept
+    {
+        return false;
+    }
+};
+
+/**
+ * @brief Helper for appending integral key of member path to binary key.
+ */
+template <typename T>
+struct member_path_key_t<T,hana::when<std::is_integral<T>::value>>
+{
+    bool operator() (std::string& dst, const T& id) const
+    {
+        dst.append(reinterpret_cast<const char*>(&id),sizeof(T));
+        return true;
+    }
+};
+
+/**
+ * @brief Helper for appending string key of member path to binary key.
+ */
+template <typename T>
+struct member_path_key_t<T,hana::when<
+            std::is_constructible<string_view,T>::value
+            &&
+            !hana::is_a<property_tag,T>
+        >>
+{
+    bool operator() (std::string& dst, const T& id) const
+    {
+        string_view str(id);
+        auto size=str.size();
+        dst.append(reinterpret_cast<const char*>(&size),sizeof(size));
+        dst.append(str.data(),str.size());
+        return true;
+    }
+};
+
+/**
+ * @brief Helper for appending stateless property key of member path to binary key.
+ *
+ * Type of property is a part of the type of member path, so nothing is appended.
+ */
+template <typename T>
+struct member_path_key_t<T,hana::when<
+            hana::is_a<property_tag,T>
+            &&
+            std::is_empty<T>::value
+        >>
+{
+    bool operator() (std::string&, const T&) const noexcept
+    {
+        return true;
+    }
+};
+
+/**
+ * @brief Helper for appending key of element aggregation to binary key.
+ *
+ * Such keys are formatted by their names, so the name is appended.
+ */
+template <typename T>
+struct member_path_key_t<T,hana::when<is_element_aggregation_key<T>::value>>
+{
+    bool operator() (std::string& dst, const T& id) const
+    {
+        return member_path_key_t<std::string>{}(dst,id.name());
+    }
+};
+
+/**
+ * @brief Append binary key of member path to destination string.
+ * @param dst Destination string.
+ * @param path Member path.
+ * @return True if all keys of the path can be appended.
+ *
+ * Binary keys of paths of the same type are equal only if the paths are equal.
+ */
+template <typename PathT>
+bool member_path_key(std::string& dst, const PathT& path)
+{
+    bool ok=true;
+    hana::for_each(
+        path,
+        [&dst,&ok](const auto& key)
+        {
+            if (ok)
+            {
+                using key_type=unwrap_object_t<decltype(key)>;
+                ok=member_path_key_t<key_type>{}(dst,unwrap_object(key));
+            }
+        }
+    );
+    return ok;
+}
+
+/**
+ * @brief Check if member path contains keys of element aggregations.
+ */
+template <typename PathT>
+constexpr auto has_element_aggregation_keys(const PathT& path)
+{
+    return hana::any_of(
+        path,
+        [](const auto& key)
+        {
+            using key_type=unwrap_object_t<decltype(key)>;
+            return hana::bool_c<is_element_aggregation_key<key_type>::value>;
+        }
+    );
+}
+
+//-------------------------------------------------------------
+
+}
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_MEMBER_PATH_KEY_HPP
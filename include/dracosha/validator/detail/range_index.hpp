@@ -0,0 +1,346 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/detail/range_index.hpp
+*
+*  Defines hash index of range elements used by hashed ranges.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_RANGE_INDEX_HPP
+#define DRACOSHA_VALIDATOR_RANGE_INDEX_HPP
+
+#include <cstdint>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <type_traits>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/detail/icase_compare.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Mix bits of hash value.
+ */
+inline size_t range_index_mix(uint64_t v) noexcept
+{
+    // finalizer of splitmix64
+    v^=v>>30;
+    v*=0xbf58476d1ce4e5b9ULL;
+    v^=v>>27;
+    v*=0x94d049bb133111ebULL;
+    v^=v>>31;
+    return static_cast<size_t>(v);
+}
+
+/**
+ * @brief Hash string using FNV-1a.
+ */
+inline size_t range_index_hash_string(string_view str) noexcept
+{
+    uint64_t hash=14695981039346656037ULL;
+    for (auto ch:str)
+    {
+        hash^=static_cast<unsigned char>(ch);
+        hash*=1099511628211ULL;
+    }
+    return range_index_mix(hash);
+}
+
+/**
+ * @brief Hash string using FNV-1a with characters folded to upper case.
+ *
+ * Characters are folded the same way as by case insensitive lexicographical operators.
+ */
+inline size_t range_index_hash_string_folded(string_view str)
+{
+    uint64_t hash=14695981039346656037ULL;
+    for (auto ch:str)
+    {
+        hash^=static_cast<unsigned char>(icase_fold(ch));
+        hash*=1099511628211ULL;
+    }
+    return range_index_mix(hash);
+}
+
+/**
+ * @brief Traits of range elements that can not be indexed.
+ */
+template <typename ValueT, typename=hana::when<true>>
+struct range_key_traits
+{
+    using indexed=std::false_type;
+    using case_folding=std::false_type;
+
+    template <typename T>
+    using is_compatible=std::false_type;
+};
+
+/**
+ * @brief Traits of string range elements.
+ */
+template <typename ValueT>
+struct range_key_traits<ValueT,
+            hana::when<std::is_constructible<string_view,const ValueT&>::value>
+        >
+{
+    using indexed=std::true_type;
+    using case_folding=std::true_type;
+
+    template <typename T>
+    using is_compatible=std::is_constructible<string_view,const T&>;
+
+    template <typename T>
+    static size_t hash(const T& v) noexcept
+    {
+        return range_index_hash_string(string_view(v));
+    }
+
+    template <typename T>
+    static size_t ihash(const T& v)
+    {
+        return range_index_hash_string_folded(string_view(v));
+    }
+};
+
+/**
+ * @brief Check if type is integral but not bool.
+ */
+template <typename T>
+using is_range_integral=std::integral_constant<bool,std::is_integral<T>::value && !std::is_same<T,bool>::value>;
+
+/**
+ * @brief Check if integral key can be looked up in index of integral elements.
+ */
+template <typename ValueT, typename T, typename=hana::when<true>>
+struct range_integral_key_compatible : public std::false_type
+{};
+
+/**
+ * @brief Integral key can be looked up in index if the hash of the key is the same as the hash of any element it is equal to.
+ *
+ * When signed value is compared to unsigned value then signed value is converted to unsigned type of the same size,
+ * see safe_compare. Thus, unsigned keys can be looked up in index of signed elements only if the elements are 64 bit wide.
+ */
+template <typename ValueT, typename T>
+struct range_integral_key_compatible<ValueT,T,hana::when<is_range_integral<T>::value>>
+    : public std::integral_constant<bool,
+            !(std::is_signed<ValueT>::value && std::is_unsigned<T>::value && sizeof(ValueT)<sizeof(uint64_t))
+        >
+{};
+
+/**
+ * @brief Get integral key for hashing when it is compared to elements of the same signedness.
+ */
+template <typename ValueT, typename T>
+uint64_t range_integral_key(const T& v, std::true_type) noexcept
+{
+    return static_cast<uint64_t>(v);
+}
+
+/**
+ * @brief Get integral key for hashing when it is compared to elements of different signedness.
+ */
+template <typename ValueT, typename T>
+uint64_t range_integral_key(const T& v, std::false_type) noexcept
+{
+    return static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(v));
+}
+
+/**
+ * @brief Traits of integral range elements.
+ */
+template <typename ValueT>
+struct range_key_traits<ValueT,
+            hana::when<is_range_integral<ValueT>::value>
+        >
+{
+    using indexed=std::true_type;
+    using case_folding=std::false_type;
+
+    template <typename T>
+    using is_compatible=range_integral_key_compatible<ValueT,T>;
+
+    template <typename T>
+    static size_t hash(const T& v) noexcept
+    {
+        return range_index_mix(range_integral_key<ValueT>(v,
+                    std::integral_constant<bool,std::is_signed<T>::value==std::is_signed<ValueT>::value>{}
+                ));
+    }
+};
+
+/**
+ * @brief Traits of floating point and enum range elements.
+ *
+ * Lookup is performed in the index only for values of exactly the same type.
+ */
+template <typename ValueT>
+struct range_key_traits<ValueT,
+            hana::when<std::is_floating_point<ValueT>::value || std::is_enum<ValueT>::value>
+        >
+{
+    using indexed=std::true_type;
+    using case_folding=std::false_type;
+
+    template <typename T>
+    using is_compatible=std::is_same<T,ValueT>;
+
+    static size_t hash(const ValueT& v) noexcept
+    {
+        return range_index_mix(static_cast<uint64_t>(std::hash<ValueT>{}(v)));
+    }
+};
+
+/**
+ * @brief Open addressing hash index of container elements.
+ *
+ * Index keeps pointers to elements, so the container must not be modified after the index is built.
+ */
+template <typename ValueT>
+class range_index
+{
+    public:
+
+        /**
+         * @brief Build index.
+         * @param container Container of elements.
+         * @param hash_fn Hash function of elements.
+         */
+        template <typename ContainerT, typename HashFnT>
+        void build(const ContainerT& container, HashFnT&& hash_fn)
+        {
+            // load factor is kept at most 0.5
+            size_t capacity=16;
+            while (capacity<container.size()*2)
+            {
+                capacity<<=1;
+            }
+            _mask=capacity-1;
+            _slots.assign(capacity,slot{0,nullptr});
+
+            for (const auto& v:container)
+            {
+                auto hash=hash_fn(v);
+                auto i=hash&_mask;
+                while (_slots[i].value!=nullptr)
+                {
+                    i=(i+1)&_mask;
+                }
+                _slots[i]=slot{hash,&v};
+            }
+        }
+
+        /**
+         * @brief Find element in index.
+         * @param hash Hash of the key.
+         * @param pred Predicate to check if element matches the key.
+         * @return True if matching element is found.
+         */
+        template <typename PredT>
+        bool find(size_t hash, PredT&& pred) const
+        {
+            if (_slots.empty())
+            {
+                return false;
+            }
+            for (auto i=hash&_mask;;i=(i+1)&_mask)
+            {
+                const auto& s=_slots[i];
+                if (s.value==nullptr)
+                {
+                    return false;
+                }
+                if (s.hash==hash && pred(*s.value))
+                {
+                    return true;
+                }
+            }
+        }
+
+    private:
+
+        struct slot
+        {
+            size_t hash;
+            const ValueT* value;
+        };
+
+        std::vector<slot> _slots;
+        size_t _mask=0;
+};
+
+/**
+ * @brief Storage of hashed range that keeps container together with its indexes.
+ */
+template <typename T>
+struct hashed_range_storage
+{
+    using container_type=std::decay_t<T>;
+    using value_type=typename container_type::value_type;
+    using key_traits=range_key_traits<value_type>;
+
+    /**
+     * @brief Check if elements can be indexed.
+     *
+     * Elements can be indexed only if container iterators return references to stored elements.
+     */
+    using indexed=std::integral_constant<bool,
+            key_traits::indexed::value
+            &&
+            std::is_lvalue_reference<decltype(*std::begin(std::declval<const container_type&>()))>::value
+        >;
+    using case_folding=std::integral_constant<bool,indexed::value && key_traits::case_folding::value>;
+
+    template <typename T1>
+    hashed_range_storage(T1&& container)
+        : container(std::forward<T1>(container))
+    {
+        build(indexed{},case_folding{});
+    }
+
+    T container;
+    range_index<value_type> index;
+    range_index<value_type> iindex;
+
+    private:
+
+        void build(std::false_type, std::false_type)
+        {}
+
+        void build(std::true_type, std::false_type)
+        {
+            index.build(container,[](const value_type& v){return key_traits::hash(v);});
+        }
+
+        void build(std::true_type, std::true_type)
+        {
+            build(std::true_type{},std::false_type{});
+            iindex.build(container,[](const value_type& v){return key_traits::ihash(v);});
+        }
+};
+
+//-------------------------------------------------------------
+
+}
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_RANGE_INDEX_HPP
@@ -0,0 +1,274 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/detail/string_scanners.hpp
+*
+*  Defines scanners of character classes used by string pattern operators.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_STRING_SCANNERS_HPP
+#define DRACOSHA_VALIDATOR_STRING_SCANNERS_HPP
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define DRACOSHA_VALIDATOR_SCANNERS_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+    #include <emmintrin.h>
+    #define DRACOSHA_VALIDATOR_SCANNERS_SSE2
+#endif
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Character classes supported by scanners.
+ */
+enum class char_class : int
+{
+    digit, //!< [0-9]
+    hex, //!< [0-9a-fA-F]
+    word //!< [0-9a-zA-Z_]
+};
+
+/**
+ * @brief Scalar check if character belongs to character class.
+ */
+template <char_class Class>
+constexpr bool is_char_of_class(char ch) noexcept
+{
+    return (ch>='0' && ch<='9')
+            ||
+           (Class==char_class::hex && ((ch>='a' && ch<='f') || (ch>='A' && ch<='F')))
+            ||
+           (Class==char_class::word && ((ch>='a' && ch<='z') || (ch>='A' && ch<='Z') || ch=='_'));
+}
+
+inline unsigned count_trailing_zeros(uint32_t v) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index=0;
+    _BitScanForward(&index,v);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(v));
+#endif
+}
+
+#ifdef DRACOSHA_VALIDATOR_SCANNERS_SSE2
+
+/**
+ * @brief Get mask of bytes in range [lo,hi] of SSE2 vector.
+ *
+ * Signed comparison is safe because all ranges are within ASCII and non-ASCII bytes are negative.
+ */
+inline __m128i sse2_in_range(__m128i v, char lo, char hi) noexcept
+{
+    return _mm_and_si128(
+                _mm_cmpgt_epi8(v,_mm_set1_epi8(static_cast<char>(lo-1))),
+                _mm_cmplt_epi8(v,_mm_set1_epi8(static_cast<char>(hi+1)))
+            );
+}
+
+template <char_class Class>
+uint32_t sse2_class_mask(const char* data) noexcept
+{
+    auto v=_mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    auto mask=sse2_in_range(v,'0','9');
+    if (Class!=char_class::digit)
+    {
+        auto lower=_mm_or_si128(v,_mm_set1_epi8(0x20));
+        mask=_mm_or_si128(mask,sse2_in_range(lower,'a',Class==char_class::hex?'f':'z'));
+        if (Class==char_class::word)
+        {
+            mask=_mm_or_si128(mask,_mm_cmpeq_epi8(v,_mm_set1_epi8('_')));
+        }
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(mask));
+}
+
+#endif
+
+#ifdef DRACOSHA_VALIDATOR_SCANNERS_AVX2
+
+inline __m256i avx2_in_range(__m256i v, char lo, char hi) noexcept
+{
+    return _mm256_and_si256(
+                _mm256_cmpgt_epi8(v,_mm256_set1_epi8(static_cast<char>(lo-1))),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi+1)),v)
+            );
+}
+
+template <char_class Class>
+uint32_t avx2_class_mask(const char* data) noexcept
+{
+    auto v=_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    auto mask=avx2_in_range(v,'0','9');
+    if (Class!=char_class::digit)
+    {
+        auto lower=_mm256_or_si256(v,_mm256_set1_epi8(0x20));
+        mask=_mm256_or_si256(mask,avx2_in_range(lower,'a',Class==char_class::hex?'f':'z'));
+        if (Class==char_class::word)
+        {
+            mask=_mm256_or_si256(mask,_mm256_cmpeq_epi8(v,_mm256_set1_epi8('_')));
+        }
+    }
+    return static_cast<uint32_t>(_mm256_movemask_epi8(mask));
+}
+
+#endif
+
+/**
+ * @brief Count length of prefix of string that consists of characters of the class.
+ * @param data Pointer to string data.
+ * @param size Size of string.
+ * @return Length of prefix.
+ */
+template <char_class Class>
+size_t count_chars_of_class(const char* data, size_t size) noexcept
+{
+    size_t i=0;
+#ifdef DRACOSHA_VALIDATOR_SCANNERS_AVX2
+    for (;i+32<=size;i+=32)
+    {
+        auto mask=avx2_class_mask<Class>(data+i);
+        if (mask!=0xFFFFFFFFu)
+        {
+            return i+count_trailing_zeros(~mask);
+        }
+    }
+#endif
+#ifdef DRACOSHA_VALIDATOR_SCANNERS_SSE2
+    for (;i+16<=size;i+=16)
+    {
+        auto mask=sse2_class_mask<Class>(data+i);
+        if (mask!=0xFFFFu)
+        {
+            return i+count_trailing_zeros(~mask);
+        }
+    }
+#endif
+    for (;i<size;i++)
+    {
+        if (!is_char_of_class<Class>(data[i]))
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief Check if all characters of string belong to character class.
+ * @param str String.
+ * @return True if all characters belong to the class, true for empty string.
+ */
+template <char_class Class>
+bool all_chars_of_class(string_view str) noexcept
+{
+    return count_chars_of_class<Class>(str.data(),str.size())==str.size();
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Check if string is an integer number.
+ * @param str String.
+ * @return True if string is an optional sign followed by decimal digits.
+ *
+ * Result is the same as for checking with strtol(): the string is considered to end at the first null character.
+ */
+inline bool is_integer(string_view str) noexcept
+{
+    size_t size=str.size();
+    const char* data=str.data();
+    size_t i=0;
+    if (size!=0 && (data[0]=='-' || data[0]=='+'))
+    {
+        ++i;
+    }
+    size_t digits=count_chars_of_class<char_class::digit>(data+i,size-i);
+    if (digits==0)
+    {
+        return false;
+    }
+    i+=digits;
+    return i==size || data[i]=='\0';
+}
+
+/**
+ * @brief Check if string is a floating point number.
+ * @param str String.
+ * @return True if string matches regular expression [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)?
+ */
+inline bool is_float(string_view str) noexcept
+{
+    size_t size=str.size();
+    const char* data=str.data();
+    size_t i=0;
+    if (i<size && (data[i]=='-' || data[i]=='+'))
+    {
+        ++i;
+    }
+    size_t int_digits=count_chars_of_class<char_class::digit>(data+i,size-i);
+    i+=int_digits;
+    if (i<size && data[i]=='.')
+    {
+        ++i;
+        size_t frac_digits=count_chars_of_class<char_class::digit>(data+i,size-i);
+        if (frac_digits==0)
+        {
+            return false;
+        }
+        i+=frac_digits;
+    }
+    else if (int_digits==0)
+    {
+        return false;
+    }
+    if (i<size && (data[i]=='e' || data[i]=='E'))
+    {
+        ++i;
+        if (i<size && (data[i]=='-' || data[i]=='+'))
+        {
+            ++i;
+        }
+        size_t exp_digits=count_chars_of_class<char_class::digit>(data+i,size-i);
+        if (exp_digits==0)
+        {
+            return false;
+        }
+        i+=exp_digits;
+    }
+    return i==size;
+}
+
+//-------------------------------------------------------------
+
+}
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_STRING_SCANNERS_HPP
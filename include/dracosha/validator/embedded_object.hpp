@@ -24,6 +24,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/get_member.hpp>
 #include <dracosha/validator/operators/exists.hpp>
 #include <dracosha/validator/adapters/impl/intermediate_adapter_traits.hpp>
+#include <dracosha/validator/adapters/impl/member_lookup_cache.hpp>
 #include <dracosha/validator/member_path.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
@@ -150,13 +151,20 @@ struct embedded_object_has_path_impl
     template <typename AdapterT, typename PathT, typename T2>
     bool operator() (const AdapterT& adapter, PathT&& path, T2&& b) const
     {
-        auto check_path_exists=[&b](auto&& obj, auto&& path)
+        auto check_path_exists=[&b,&adapter](auto&& obj, auto&& path)
         {
             return hana::if_(
                 is_member_path_valid(obj,path),
-                [&b](auto&& obj, auto&& path)
+                [&b,&adapter](auto&& obj, auto&& path)
                 {
-                    return exists(obj,std::forward<decltype(path)>(path))==b;
+                    return lookup_exists_cached(
+                                adapter,
+                                path,
+                                [&]()
+                                {
+                                    return exists(obj,path);
+                                }
+                           )==b;
                 },
                 [&b](auto&&, auto&&)
                 {
@@ -313,7 +321,15 @@ struct embedded_object_member_impl
     template <typename AdapterT, typename MemberT>
     auto operator() (const AdapterT& adapter, const MemberT& member) const -> decltype(auto)
     {
-        return get_member(embedded_object(adapter),embedded_object_path_suffix(adapter,path_of(member)));
+        const auto& path=path_of(member);
+        return lookup_member_cached(
+                    adapter,
+                    path,
+                    [&]() -> decltype(auto)
+                    {
+                        return get_member(embedded_object(adapter),embedded_object_path_suffix(adapter,path));
+                    }
+               );
     }
 };
 /**
@@ -122,6 +122,7 @@ class error_report : public error
 
         std::string _message;
         friend struct validate_t;
+        friend struct validate_implications_t;
 };
 
 /**
@@ -23,6 +23,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/utils/conditional_fold.hpp>
 #include <dracosha/validator/check_member_path.hpp>
 #include <dracosha/validator/member_path.hpp>
+#include <dracosha/validator/path_trie.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -95,10 +96,16 @@ struct has_path_impl
             }
         );
     }
+
+    template <typename T2>
+    bool operator() (const path_trie& path_ts, const T2& path) const
+    {
+        return path_ts.has_prefix_of(path);
+    }
 };
 /**
  * @brief Check if foldable container of paths contains certain path.
- * @param path_ts COntainer of paths.
+ * @param path_ts Either foldable container of paths or path_trie.
  * @param path Path to test.
  * @return Boolean result.
  */
@@ -106,6 +113,31 @@ constexpr has_path_impl has_path{};
 
 //-------------------------------------------------------------
 
+/**
+ * @brief Implementer of paths_empty().
+ */
+struct paths_empty_impl
+{
+    template <typename T>
+    constexpr bool operator() (const T& path_ts) const
+    {
+        return hana::is_empty(path_ts);
+    }
+
+    bool operator() (const path_trie& path_ts) const noexcept
+    {
+        return path_ts.empty();
+    }
+};
+/**
+ * @brief Check if container of paths is empty.
+ * @param path_ts Either foldable container of paths or path_trie.
+ * @return Boolean result.
+ */
+constexpr paths_empty_impl paths_empty{};
+
+//-------------------------------------------------------------
+
 /**
  * @brief Adapter traits for member filtering adapter.
  *
@@ -160,11 +192,19 @@ class filter_path_traits : public BaseTraitsT,
          * @brief Constructor.
          * @param Original adapter traits.
          * @param exclude_paths Excluded paths.
+         *
+         * Constructor is disabled if types of included and excluded paths are the same,
+         * e.g. if both are path_trie, in that case use constructor with both included and excluded paths.
          */
-        template <typename BaseTraitsT1>
+        template <typename BaseTraitsT1, typename ExcludePathsT1,
+                  typename =std::enable_if_t<
+                      std::is_same<ExcludePathsT1,ExcludePathsT>::value
+                      &&
+                      !std::is_same<ExcludePathsT1,IncludePathsT>::value
+                  >>
         filter_path_traits(
                 BaseTraitsT1&& traits,
-                ExcludePathsT exclude_paths
+                ExcludePathsT1 exclude_paths
             )
             : filter_path_traits(
                   std::forward<BaseTraitsT1>(traits),
@@ -181,7 +221,7 @@ class filter_path_traits : public BaseTraitsT,
         template <typename PathT>
         bool filter(const PathT& path) const noexcept
         {
-            bool included=hana::is_empty(_include_paths)
+            bool included=paths_empty(_include_paths)
                     || has_path(_include_paths,path);
 
             return !(included && !has_path(_exclude_paths,path));
@@ -232,7 +272,7 @@ constexpr filter_path_impl filter_path{};
 /**
  * @brief Helper for building filtering adapter with explicit list of included paths.
  * @param adapter Original validation adapter.
- * @param paths Container with list of explicitly included paths.
+ * @param paths Container with list of explicitly included paths or path_trie.
  * @return Member filtering adapter.
  */
 template <typename AdapterT, typename PathsT>
@@ -253,7 +293,7 @@ auto include_paths(AdapterT adapter, PathsT&& paths)
 /**
  * @brief Helper for building filtering adapter with explicit list of excluded paths.
  * @param adapter Original validation adapter.
- * @param paths Container with list of explicitly excluded paths.
+ * @param paths Container with list of explicitly excluded paths or path_trie.
  * @return Member filtering adapter.
  */
 template <typename AdapterT, typename PathsT>
@@ -274,8 +314,8 @@ auto exclude_paths(AdapterT adapter, PathsT&& paths)
 /**
  * @brief Helper for building filtering adapter with explicit lists of included and excluded paths.
  * @param adapter Original validation adapter.
- * @param in_paths Container with list of explicitly included paths.
- * @param ex_paths Container with list of explicitly excluded paths.
+ * @param in_paths Container with list of explicitly included paths or path_trie.
+ * @param ex_paths Container with list of explicitly excluded paths or path_trie.
  * @return Member filtering adapter.
  */
 template <typename AdapterT, typename InPathsT, typename ExPathsT>
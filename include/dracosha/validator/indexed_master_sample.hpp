@@ -0,0 +1,317 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/indexed_master_sample.hpp
+*
+*  Defines wrapper of master sample object with index of resolved members.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_INDEXED_MASTER_SAMPLE_HPP
+#define DRACOSHA_VALIDATOR_INDEXED_MASTER_SAMPLE_HPP
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/master_sample.hpp>
+#include <dracosha/validator/get_member.hpp>
+#include <dracosha/validator/operators/exists.hpp>
+#include <dracosha/validator/detail/member_path_key.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Index of members of master sample object.
+ *
+ * Index maps binary keys of member paths to results of members lookup in the sample.
+ *
+ * Index is thread safe. Members are kept in a single table, lookups of indexed members acquire shared lock
+ * and only adding of a member acquires exclusive lock, so memory used by the index is proportional to the number
+ * of distinct member paths checked with the sample.
+ */
+class master_sample_index
+{
+    public:
+
+        /**
+         * @brief Result of member lookup.
+         */
+        struct entry
+        {
+            bool exists;
+            const void* member; //!< Address of member or nullptr if member is not addressable.
+        };
+
+        master_sample_index()=default;
+        ~master_sample_index()=default;
+        master_sample_index(const master_sample_index&)=delete;
+        master_sample_index(master_sample_index&&)=delete;
+        master_sample_index& operator= (const master_sample_index&)=delete;
+        master_sample_index& operator= (master_sample_index&&)=delete;
+
+        /**
+         * @brief Find member in the index or resolve it and add to the index.
+         * @param path Member path.
+         * @param resolve Handler to invoke to resolve the member if it is not found in the index.
+         * @param indexed Set to false if the path can not be indexed.
+         * @return Result of member lookup.
+         */
+        template <typename PathT, typename ResolveT>
+        entry find(const PathT& path, ResolveT&& resolve, bool& indexed)
+        {
+            // buffer of key is reused in order to avoid allocations on each lookup
+            static thread_local std::string key;
+            key.clear();
+            const void* tag=type_tag<PathT>();
+            key.append(reinterpret_cast<const char*>(&tag),sizeof(tag));
+            indexed=member_path_key(key,path);
+            if (!indexed)
+            {
+                return entry{false,nullptr};
+            }
+
+            {
+                std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+                auto it=_table.find(key);
+                if (it!=_table.end())
+                {
+                    return it->second;
+                }
+            }
+
+            auto result=resolve();
+            std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+            return _table.emplace(key,result).first->second;
+        }
+
+        /**
+         * @brief Get number of indexed members.
+         * @return Number of members.
+         */
+        size_t size() const
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+            return _table.size();
+        }
+
+        /**
+         * @brief Clear index.
+         */
+        void clear()
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+            _table.clear();
+        }
+
+    private:
+
+        template <typename PathT>
+        static const void* type_tag() noexcept
+        {
+            static const char tag=0;
+            return &tag;
+        }
+
+        mutable std::shared_timed_mutex _mutex;
+        std::unordered_map<std::string,entry> _table;
+};
+
+}
+
+/**
+ * @brief Wrapper of master sample object with index of resolved members.
+ *
+ * Indexed master sample is used the same way as master sample, see master_sample.
+ * When a member is looked up in the sample for the first time then the result of the lookup is added to the index,
+ * so that subsequent checks of the same member, e.g. checks of a large number of objects against the same sample,
+ * take the member from the index instead of finding it in the sample again.
+ *
+ * Members whose paths contain keys other than strings, integers and properties as well as members of element aggregations
+ * are not indexed and are looked up in the sample each time.
+ *
+ * Sample object must not be modified while it is indexed, call clear_index() if the sample was modified.
+ * Copies of indexed master sample share the same index. Validators using the same indexed master sample
+ * can be applied concurrently.
+ */
+template <typename T>
+struct indexed_master_sample
+{
+    using hana_tag=master_sample_tag;
+
+    /**
+     * @brief Ctor
+     * @param Sample object
+     */
+    indexed_master_sample(const T& obj)
+        : ref(obj),
+          index(std::make_shared<detail::master_sample_index>())
+    {}
+
+    /**
+     * @brief Get Sample object
+     * @return Sample object
+     */
+    const T& operator() () const
+    {
+        return ref;
+    }
+
+    /**
+     * @brief Get number of indexed members.
+     * @return Number of members.
+     */
+    size_t index_size() const
+    {
+        return index->size();
+    }
+
+    /**
+     * @brief Clear index of members.
+     */
+    void clear_index() const
+    {
+        index->clear();
+    }
+
+    const T& ref;
+    std::shared_ptr<detail::master_sample_index> index;
+};
+
+/**
+ * @brief Check if master sample is indexed.
+ */
+template <typename T>
+struct is_indexed_master_sample : public std::false_type
+{};
+
+/**
+ * @brief Check if master sample is indexed.
+ */
+template <typename T>
+struct is_indexed_master_sample<indexed_master_sample<T>> : public std::true_type
+{};
+
+/**
+  @brief Wrap object to be used as indexed master sample.
+  @param obj Object to use as a master sample.
+  @return Wrapped master sample object.
+*/
+template <typename T>
+auto indexed_sample(const T& obj)
+{
+    return indexed_master_sample<T>(obj);
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementer of with_sample_member().
+ */
+struct with_sample_member_impl
+{
+    template <typename SampleT, typename PathT, typename FoundT, typename NotFoundT>
+    auto operator() (const SampleT& sample, const PathT& path, FoundT&& found, NotFoundT&& not_found) const
+    {
+        const auto& obj=sample();
+        auto direct=[&]()
+        {
+            if (!exists(obj,path))
+            {
+                return not_found();
+            }
+            return found(get_member(obj,path));
+        };
+
+        return hana::eval_if(
+            hana::bool_c<
+                is_indexed_master_sample<std::decay_t<SampleT>>::value
+                &&
+                !decltype(detail::has_element_aggregation_keys(path))::value
+            >,
+            [&](auto&& _)
+            {
+                using member_type=decltype(get_member(_(obj),path));
+                constexpr bool addressable=std::is_lvalue_reference<member_type>::value;
+
+                bool indexed=false;
+                auto item=_(sample).index->find(
+                    path,
+                    [&]()
+                    {
+                        if (!exists(obj,path))
+                        {
+                            return detail::master_sample_index::entry{false,nullptr};
+                        }
+                        return detail::master_sample_index::entry{
+                            true,
+                            hana::if_(
+                                hana::bool_c<addressable>,
+                                [](auto&& member) -> const void* {return std::addressof(member);},
+                                [](auto&&) -> const void* {return nullptr;}
+                            )(get_member(obj,path))
+                        };
+                    },
+                    indexed
+                );
+                if (!indexed)
+                {
+                    return direct();
+                }
+                if (!item.exists)
+                {
+                    return not_found();
+                }
+                return hana::eval_if(
+                    hana::bool_c<addressable>,
+                    [&](auto&& _)
+                    {
+                        return found(*static_cast<const std::remove_reference_t<member_type>*>(_(item).member));
+                    },
+                    [&](auto&&)
+                    {
+                        return found(get_member(obj,path));
+                    }
+                );
+            },
+            [&](auto&&)
+            {
+                return direct();
+            }
+        );
+    }
+};
+/**
+ * @brief Invoke handler with member of master sample.
+ * @param sample Master sample or indexed master sample.
+ * @param path Member path.
+ * @param found Handler to invoke with the member if the sample has the member.
+ * @param not_found Handler to invoke if the sample does not have the member.
+ * @return Result of the invoked handler.
+ *
+ * Members of indexed master samples are looked up in the index, see indexed_master_sample.
+ */
+constexpr with_sample_member_impl with_sample_member{};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_INDEXED_MASTER_SAMPLE_HPP
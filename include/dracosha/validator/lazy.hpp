@@ -19,24 +19,313 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef DRACOSHA_VALIDATOR_LAZY_HPP
 #define DRACOSHA_VALIDATOR_LAZY_HPP
 
+#include <new>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
 #include <dracosha/validator/config.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+/**
+ * @brief Get unique ID for a new lazy handler.
+ * @return ID.
+ */
+inline uint64_t next_lazy_id() noexcept
+{
+    static std::atomic<uint64_t> counter{0};
+    return ++counter;
+}
+
+/**
+ * @brief Results of lazy handlers evaluated within a validation pass on the current thread.
+ *
+ * Validation pass is opened by the outermost validator when it is applied and results are cleared when the pass is closed.
+ * Results are keyed by IDs of lazy handlers, copies of a handler share the same ID and the same result.
+ *
+ * The first results are kept in inline slots of the pass and small values are constructed in buffers of the slots,
+ * so that memoization does not allocate memory in most cases.
+ */
+class lazy_pass
+{
+    public:
+
+        /**
+         * @brief Number of inline slots for results.
+         */
+        constexpr static const size_t inline_count=8;
+
+        /**
+         * @brief Maximum size of a value constructed in buffer of a slot.
+         */
+        constexpr static const size_t inline_size=32;
+
+        lazy_pass()=default;
+        ~lazy_pass()
+        {
+            clear();
+        }
+
+        lazy_pass(const lazy_pass&)=delete;
+        lazy_pass(lazy_pass&&)=delete;
+        lazy_pass& operator= (const lazy_pass&)=delete;
+        lazy_pass& operator= (lazy_pass&&)=delete;
+
+        /**
+         * @brief Get validation pass of the current thread.
+         */
+        static lazy_pass& current() noexcept
+        {
+            static thread_local lazy_pass pass;
+            return pass;
+        }
+
+        /**
+         * @brief Open validation pass or nested validation scope.
+         */
+        void open() noexcept
+        {
+            ++_depth;
+        }
+
+        /**
+         * @brief Close validation scope, when the outermost scope is closed then the results are cleared.
+         */
+        void close() noexcept
+        {
+            if (--_depth==0)
+            {
+                clear();
+            }
+        }
+
+        /**
+         * @brief Evaluate handler once within validation pass.
+         * @param key ID of the handler.
+         * @param fn Handler.
+         * @return Pointer to result of the handler.
+         *
+         * If pass is not open then nullptr is returned and handler is not invoked.
+         * If handler returns lvalue reference then pointer to referred object is returned.
+         */
+        template <typename ResultT, typename FnT>
+        ResultT* evaluate(uint64_t key, const FnT& fn)
+        {
+            if (_depth==0)
+            {
+                return nullptr;
+            }
+            const void* tag=type_tag<ResultT>();
+            for (size_t i=0;i<_count;i++)
+            {
+                const auto& item=slot(i);
+                if (item.key==key && item.tag==tag)
+                {
+                    return static_cast<ResultT*>(item.value);
+                }
+            }
+            // result is evaluated before a slot is taken because handler can apply other validators
+            return emplace<ResultT>(fn(),key,tag);
+        }
+
+    private:
+
+        struct result
+        {
+            uint64_t key=0;
+            const void* tag=nullptr;
+            void* value=nullptr;
+            void (*destroy)(void*)=nullptr;
+            typename std::aligned_storage<inline_size>::type buf;
+        };
+
+        template <typename T>
+        static const void* type_tag() noexcept
+        {
+            static const char tag=0;
+            return &tag;
+        }
+
+        template <typename T>
+        static void destroy_inline(void* ptr) noexcept
+        {
+            static_cast<T*>(ptr)->~T();
+        }
+
+        template <typename T>
+        static void destroy_heap(void* ptr) noexcept
+        {
+            delete static_cast<T*>(ptr);
+        }
+
+        result& slot(size_t index) noexcept
+        {
+            return index<inline_count ? _inline[index] : *_overflow[index-inline_count];
+        }
+
+        /**
+         * @brief Get free slot, the slot is taken only when _count is incremented after construction of the value.
+         */
+        result& free_slot()
+        {
+            if (_count>=inline_count+_overflow.size())
+            {
+                _overflow.emplace_back(new result());
+            }
+            return slot(_count);
+        }
+
+        template <typename ResultT, typename ValueT>
+        ResultT* emplace(ValueT&& val, uint64_t key, const void* tag,
+                         std::enable_if_t<!std::is_lvalue_reference<ValueT>::value,void*> =nullptr)
+        {
+            using small=std::integral_constant<bool,
+                            sizeof(ResultT)<=inline_size
+                            &&
+                            alignof(ResultT)<=alignof(decltype(result::buf))
+                        >;
+            auto& item=free_slot();
+            item.value=construct<ResultT>(item,std::forward<ValueT>(val),small{});
+            item.key=key;
+            item.tag=tag;
+            ++_count;
+            return static_cast<ResultT*>(item.value);
+        }
+
+        template <typename ResultT, typename ValueT>
+        ResultT* emplace(ValueT&& val, uint64_t key, const void* tag,
+                         std::enable_if_t<std::is_lvalue_reference<ValueT>::value,void*> =nullptr)
+        {
+            // only addresses of objects referred by results are kept
+            auto& item=free_slot();
+            item.value=const_cast<void*>(static_cast<const void*>(std::addressof(val)));
+            item.destroy=nullptr;
+            item.key=key;
+            item.tag=tag;
+            ++_count;
+            return static_cast<ResultT*>(item.value);
+        }
+
+        template <typename ResultT, typename ValueT>
+        void* construct(result& item, ValueT&& val, std::true_type)
+        {
+            auto ptr=new (&item.buf) ResultT(std::forward<ValueT>(val));
+            item.destroy=&destroy_inline<ResultT>;
+            return ptr;
+        }
+
+        template <typename ResultT, typename ValueT>
+        void* construct(result& item, ValueT&& val, std::false_type)
+        {
+            auto ptr=new ResultT(std::forward<ValueT>(val));
+            item.destroy=&destroy_heap<ResultT>;
+            return ptr;
+        }
+
+        void clear() noexcept
+        {
+            for (size_t i=0;i<_count;i++)
+            {
+                auto& item=slot(i);
+                if (item.destroy!=nullptr)
+                {
+                    item.destroy(item.value);
+                    item.destroy=nullptr;
+                }
+            }
+            _count=0;
+            _overflow.clear();
+        }
+
+        size_t _depth=0;
+        size_t _count=0;
+        std::array<result,inline_count> _inline;
+        std::vector<std::unique_ptr<result>> _overflow;
+};
+
+/**
+ * @brief Scope of validation pass.
+ *
+ * Scope is opened in constructor and closed in destructor.
+ */
+class lazy_pass_scope
+{
+    public:
+
+        lazy_pass_scope() noexcept
+            : _pass(lazy_pass::current())
+        {
+            _pass.open();
+        }
+
+        ~lazy_pass_scope()
+        {
+            _pass.close();
+        }
+
+        lazy_pass_scope(const lazy_pass_scope&)=delete;
+        lazy_pass_scope(lazy_pass_scope&&)=delete;
+        lazy_pass_scope& operator= (const lazy_pass_scope&)=delete;
+        lazy_pass_scope& operator= (lazy_pass_scope&&)=delete;
+
+    private:
+
+        lazy_pass& _pass;
+};
+
+}
+
 struct lazy_tag;
 
 /**
  * @brief Lazy invokation handler.
+ *
+ * If Memoize is true then the handler is invoked at most once within a validation pass on the same thread,
+ * i.e. within a single call of validator's apply(). The result is reused by all checks of the pass, e.g. by checks of
+ * all elements of element aggregations. Results of handlers returning values are copied on each use,
+ * results of handlers returning references are referred to. Results are keyed by ID assigned to the handler when it is constructed,
+ * copies of the handler share the ID.
+ *
+ * If Memoize is false then the handler is invoked each time the operand is used.
  */
-template <typename T>
+template <typename T, bool Memoize=true>
 struct lazy_t
 {
     using hana_tag=lazy_tag;
     T fn;
+    uint64_t id=detail::next_lazy_id();
 
-    auto operator()() const -> decltype(fn())
+    template <bool M=Memoize>
+    auto operator()(std::enable_if_t<M,void*> =nullptr) const -> std::conditional_t<
+            std::is_lvalue_reference<decltype(fn())>::value,
+            decltype(fn()),
+            std::decay_t<decltype(fn())>
+        >
+    {
+        using result_type=std::conditional_t<
+                std::is_lvalue_reference<decltype(fn())>::value,
+                std::remove_reference_t<decltype(fn())>,
+                std::decay_t<decltype(fn())>
+            >;
+        auto result=detail::lazy_pass::current().template evaluate<result_type>(id,fn);
+        if (result==nullptr)
+        {
+            return fn();
+        }
+        return *result;
+    }
+
+    template <bool M=Memoize>
+    auto operator()(std::enable_if_t<!M,void*> =nullptr) const -> decltype(fn())
     {
         return fn();
     }
@@ -45,6 +334,8 @@ struct lazy_t
 /**
   @brief Construct handler for deferred invokation.
   @param fn Handler that will be invoked later on demand.
+
+  Handler is invoked at most once within a validation pass, see lazy_t.
 */
 template <typename T>
 auto lazy(T&& fn) -> decltype(auto)
@@ -52,6 +343,18 @@ auto lazy(T&& fn) -> decltype(auto)
     return lazy_t<decltype(fn)>{std::forward<decltype(fn)>(fn)};
 }
 
+/**
+  @brief Construct handler for deferred invokation that is invoked each time the operand is used.
+  @param fn Handler that will be invoked later on demand.
+
+  Use it for handlers whose results are intentionally different for each element of aggregations.
+*/
+template <typename T>
+auto lazy_each(T&& fn) -> decltype(auto)
+{
+    return lazy_t<decltype(fn),false>{std::forward<decltype(fn)>(fn)};
+}
+
 //-------------------------------------------------------------
 
 DRACOSHA_VALIDATOR_NAMESPACE_END
@@ -71,7 +71,7 @@ struct in_t : public op<in_t>
     template <typename T1, typename T2>
     constexpr bool operator() (const T1& a, const T2& b,
                                std::enable_if_t<
-                                 (hana::is_a<range_tag,T2> && !T2::is_sorted::value),
+                                 (hana::is_a<range_tag,T2> && !T2::is_sorted::value && !T2::is_hashed::value),
                                void*> =nullptr
                             ) const
     {
@@ -97,6 +97,19 @@ struct in_t : public op<in_t>
         const auto& container=b.container;
         return std::binary_search(std::begin(container),std::end(container),a,lt);
     }
+
+    /**
+     * @brief Call when operand is a hashed range.
+     */
+    template <typename T1, typename T2>
+    bool operator() (const T1& a, const T2& b,
+                     std::enable_if_t<
+                       (hana::is_a<range_tag,T2> && T2::is_hashed::value),
+                     void*> =nullptr
+                  ) const
+    {
+        return b.find(a,eq);
+    }
 };
 
 /**
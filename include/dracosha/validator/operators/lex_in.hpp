@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/operators/lexicographical.hpp>
 #include <dracosha/validator/operators/in.hpp>
 #include <dracosha/validator/interval.hpp>
+#include <dracosha/validator/utils/unwrap_object.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -48,21 +49,21 @@ struct lex_in_t : public op<lex_in_t>
     {
         if (b.mode==interval.closed())
         {
-            return lex_gte(a,b.from) && lex_lte(a,b.to);
+            return lex_gte(a,unwrap_object(b.from)) && lex_lte(a,unwrap_object(b.to));
         }
 
         if (b.mode==interval.open())
         {
-            return lex_gt(a,b.from) && lex_lt(a,b.to);
+            return lex_gt(a,unwrap_object(b.from)) && lex_lt(a,unwrap_object(b.to));
         }
 
         if (b.mode==interval.open_from())
         {
-            return lex_gt(a,b.from) && lex_lte(a,b.to);
+            return lex_gt(a,unwrap_object(b.from)) && lex_lte(a,unwrap_object(b.to));
         }
 
         // open_to
-        return lex_gte(a,b.from) && lex_lt(a,b.to);
+        return lex_gte(a,unwrap_object(b.from)) && lex_lt(a,unwrap_object(b.to));
     }
 
     /**
@@ -71,7 +72,7 @@ struct lex_in_t : public op<lex_in_t>
     template <typename T1, typename T2>
     constexpr bool operator() (const T1& a, const T2& b,
                                std::enable_if_t<
-                                 (hana::is_a<range_tag,T2> && !T2::is_sorted::value),
+                                 (hana::is_a<range_tag,T2> && !T2::is_sorted::value && !T2::is_hashed::value),
                                void*> =nullptr
                             ) const
     {
@@ -97,6 +98,19 @@ struct lex_in_t : public op<lex_in_t>
         const auto& container=b.container;
         return std::binary_search(std::begin(container),std::end(container),a,lex_lt);
     }
+
+    /**
+     * @brief Call when operand is a hashed range.
+     */
+    template <typename T1, typename T2>
+    bool operator() (const T1& a, const T2& b,
+                     std::enable_if_t<
+                       (hana::is_a<range_tag,T2> && T2::is_hashed::value),
+                     void*> =nullptr
+                  ) const
+    {
+        return b.find(a,lex_eq);
+    }
 };
 
 /**
@@ -141,21 +155,21 @@ struct ilex_in_t : public op<ilex_in_t>
     {
         if (b.mode==interval.closed())
         {
-            return ilex_gte(a,b.from) && ilex_lte(a,b.to);
+            return ilex_gte(a,unwrap_object(b.from)) && ilex_lte(a,unwrap_object(b.to));
         }
 
         if (b.mode==interval.open())
         {
-            return ilex_gt(a,b.from) && ilex_lt(a,b.to);
+            return ilex_gt(a,unwrap_object(b.from)) && ilex_lt(a,unwrap_object(b.to));
         }
 
         if (b.mode==interval.open_from())
         {
-            return ilex_gt(a,b.from) && ilex_lte(a,b.to);
+            return ilex_gt(a,unwrap_object(b.from)) && ilex_lte(a,unwrap_object(b.to));
         }
 
         // open_to
-        return ilex_gte(a,b.from) && ilex_lt(a,b.to);
+        return ilex_gte(a,unwrap_object(b.from)) && ilex_lt(a,unwrap_object(b.to));
     }
 
     /**
@@ -164,7 +178,7 @@ struct ilex_in_t : public op<ilex_in_t>
     template <typename T1, typename T2>
     constexpr bool operator() (const T1& a, const T2& b,
                                std::enable_if_t<
-                                 (hana::is_a<range_tag,T2> && !T2::is_sorted::value),
+                                 (hana::is_a<range_tag,T2> && !T2::is_sorted::value && !T2::is_hashed::value),
                                void*> =nullptr
                             ) const
     {
@@ -190,6 +204,19 @@ struct ilex_in_t : public op<ilex_in_t>
         const auto& container=b.container;
         return std::binary_search(std::begin(container),std::end(container),a,ilex_lt);
     }
+
+    /**
+     * @brief Call when operand is a hashed range.
+     */
+    template <typename T1, typename T2>
+    bool operator() (const T1& a, const T2& b,
+                     std::enable_if_t<
+                       (hana::is_a<range_tag,T2> && T2::is_hashed::value),
+                     void*> =nullptr
+                  ) const
+    {
+        return b.ifind(a,ilex_eq);
+    }
 };
 
 /**
@@ -19,70 +19,198 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef DRACOSHA_VALIDATOR_LEXICOGRAPHICAL_HPP
 #define DRACOSHA_VALIDATOR_LEXICOGRAPHICAL_HPP
 
+#include <cstring>
+#include <algorithm>
+
+#include <boost/range/as_literal.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/detail/icase_compare.hpp>
 #include <dracosha/validator/operators/comparison.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+/**
+ * @brief Check if both operands can be compared as strings of characters.
+ *
+ * Such operands are compared with fast functions for strings, other operands are compared with generic functions.
+ */
+template <typename T1, typename T2>
+using is_char_strings=std::integral_constant<bool,
+        std::is_constructible<string_view,const T1&>::value
+        &&
+        std::is_constructible<string_view,const T2&>::value
+    >;
+
+/**
+ * @brief Invoke fast function if operands are strings of characters, otherwise invoke fallback function.
+ */
+template <typename T1, typename T2, typename FastFnT, typename FallbackFnT>
+auto strings_invoke(const T1& a, const T2& b, FastFnT&& fast, FallbackFnT&& fallback)
+{
+    return hana::eval_if(
+        is_char_strings<T1,T2>{},
+        [&](auto&& _)
+        {
+            return fast(string_view(_(a)),string_view(_(b)));
+        },
+        [&](auto&& _)
+        {
+            return fallback(_(a),_(b));
+        }
+    );
+}
+
+/**
+ * @brief Three-way lexicographical comparison of ranges in a single pass.
+ * @return Negative value if the first range is less than the second, positive value if greater, zero if ranges are equal.
+ *
+ * Elements are compared with operator <, the same way as in boost::algorithm::lexicographical_compare().
+ */
+template <typename T1, typename T2>
+int lex_compare_ranges(const T1& a, const T2& b)
+{
+    auto ra=boost::as_literal(a);
+    auto rb=boost::as_literal(b);
+    auto it_a=boost::begin(ra);
+    auto end_a=boost::end(ra);
+    auto it_b=boost::begin(rb);
+    auto end_b=boost::end(rb);
+    for (;it_a!=end_a && it_b!=end_b;++it_a,++it_b)
+    {
+        if (*it_a<*it_b)
+        {
+            return -1;
+        }
+        if (*it_b<*it_a)
+        {
+            return 1;
+        }
+    }
+    if (it_a==end_a)
+    {
+        return it_b==end_b ? 0 : -1;
+    }
+    return 1;
+}
+
+/**
+ * @brief Three-way lexicographical comparison of strings in a single pass using memcmp().
+ * @return Negative value if the first string is less than the second, positive value if greater, zero if strings are equal.
+ */
+inline int lex_compare_strings(string_view a, string_view b) noexcept
+{
+    auto size=(std::min)(a.size(),b.size());
+    if (size!=0)
+    {
+        // strings often differ in the first character, so check it before calling memcmp()
+        if (a[0]!=b[0])
+        {
+            return a[0]<b[0] ? -1 : 1;
+        }
+        // memcmp() is used only to find out if strings differ,
+        // the differing characters are compared as char for consistency with boost::algorithm::lexicographical_compare()
+        if (std::memcmp(a.data()+1,b.data()+1,size-1)!=0)
+        {
+            auto diff=std::mismatch(a.data()+1,a.data()+size,b.data()+1);
+            return *diff.first<*diff.second ? -1 : 1;
+        }
+    }
+    return a.size()<b.size() ? -1 : (a.size()==b.size() ? 0 : 1);
+}
+
+/**
+ * @brief Three-way lexicographical comparison of operands in a single pass.
+ * @return Negative value if a is less than b, positive value if a is greater than b, zero if operands are equal.
+ *
+ * Characters of strings are compared as char, the same way as boost::algorithm::lexicographical_compare() does.
+ */
+template <typename T1, typename T2>
+int lex_compare(const T1& a, const T2& b)
+{
+    return strings_invoke(a,b,
+                          lex_compare_strings,
+                          [](const auto& x, const auto& y){return lex_compare_ranges(x,y);}
+                          );
+}
+
+}
+
 template <typename T1, typename T2, typename Enable=hana::when<true>>
 struct lex_operators
 {
     static bool eq(const T1& a, const T2& b)
     {
-        return boost::algorithm::equals(a,b);
+        return detail::strings_invoke(a,b,
+                                        [](string_view x, string_view y){return x==y;},
+                                        [](const auto& x, const auto& y){return boost::algorithm::equals(x,y);}
+                                        );
     }
 
     static bool ne (const T1& a, const T2& b)
     {
-        return !boost::algorithm::equals(a,b);
+        return !eq(a,b);
     }
 
     static bool lt(const T1& a, const T2& b)
     {
-        return boost::algorithm::lexicographical_compare(a,b);
+        return detail::lex_compare(a,b)<0;
     }
 
     static bool lte(const T1& a, const T2& b)
     {
-        return boost::algorithm::lexicographical_compare(a,b)
-                ||
-               boost::algorithm::equals(a,b);
+        return detail::lex_compare(a,b)<=0;
     }
 
     static bool gt(const T1& a, const T2& b)
     {
-        return !lte(a,b);
+        return detail::lex_compare(a,b)>0;
     }
 
     static bool gte(const T1& a, const T2& b)
     {
-        return !lt(a,b);
+        return detail::lex_compare(a,b)>=0;
     }
 
     static bool ieq(const T1& a, const T2& b)
     {
-        return boost::algorithm::iequals(a,b);
+        return detail::strings_invoke(a,b,
+                                      detail::icase_equals,
+                                      [](const auto& x, const auto& y){return boost::algorithm::iequals(x,y);}
+                                      );
     }
 
     static bool ine(const T1& a, const T2& b)
     {
-        return !boost::algorithm::iequals(a,b);
+        return !ieq(a,b);
     }
 
     static bool ilt(const T1& a, const T2& b)
     {
-        return boost::algorithm::ilexicographical_compare(a,b);
+        return detail::strings_invoke(a,b,
+                                      detail::icase_less,
+                                      [](const auto& x, const auto& y){return boost::algorithm::ilexicographical_compare(x,y);}
+                                      );
     }
 
     static bool ilte(const T1& a, const T2& b)
     {
-        return boost::algorithm::ilexicographical_compare(a,b)
-                ||
-               boost::algorithm::iequals(a,b);
+        return detail::strings_invoke(a,b,
+                                      [](string_view x, string_view y){return !detail::icase_less(y,x);},
+                                      [](const auto& x, const auto& y)
+                                      {
+                                          return boost::algorithm::ilexicographical_compare(x,y)
+                                                  ||
+                                                 boost::algorithm::iequals(x,y);
+                                      }
+                                      );
     }
 
     static bool igt(const T1& a, const T2& b)
@@ -102,7 +230,10 @@ struct lex_operators
 
     static bool icontains(const T1& a, const T2& b)
     {
-        return boost::algorithm::icontains(a,b);
+        return detail::strings_invoke(a,b,
+                                      detail::icase_contains,
+                                      [](const auto& x, const auto& y){return boost::algorithm::icontains(x,y);}
+                                      );
     }
 
     static bool starts_with(const T1& a, const T2& b)
@@ -112,7 +243,10 @@ struct lex_operators
 
     static bool istarts_with(const T1& a, const T2& b)
     {
-        return boost::algorithm::istarts_with(a,b);
+        return detail::strings_invoke(a,b,
+                                      detail::icase_starts_with,
+                                      [](const auto& x, const auto& y){return boost::algorithm::istarts_with(x,y);}
+                                      );
     }
 
     static bool ends_with(const T1& a, const T2& b)
@@ -122,7 +256,10 @@ struct lex_operators
 
     static bool iends_with(const T1& a, const T2& b)
     {
-        return boost::algorithm::iends_with(a,b);
+        return detail::strings_invoke(a,b,
+                                      detail::icase_ends_with,
+                                      [](const auto& x, const auto& y){return boost::algorithm::iends_with(x,y);}
+                                      );
     }
 };
 
@@ -20,27 +20,14 @@ Distributed under the Boost Software License, Version 1.0.
 #define DRACOSHA_VALIDATOR_NUMBER_PATTERNS_HPP
 
 #include <dracosha/validator/config.hpp>
-#include <dracosha/validator/operators/regex.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/detail/string_scanners.hpp>
 #include <dracosha/validator/operators/op_report_without_operand.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
-namespace detail
-{
-// from https://stackoverflow.com/a/2845275
-inline bool is_integer(const std::string& s)
-{
-   if(s.empty() || ((!isdigit(s[0])) && (s[0] != '-') && (s[0] != '+'))) return false;
-
-   char * p;
-   strtol(s.c_str(), &p, 10);
-
-   return (*p == 0);
-}
-}
-
 /**
  * @brief Definition of operator "must be integer".
  */
@@ -52,7 +39,7 @@ struct str_int_t : public op_report_without_operand<str_int_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        return detail::is_integer(a)==b;
+        return detail::is_integer(string_view(a))==b;
     }
 };
 
@@ -73,8 +60,8 @@ struct str_float_t : public op_report_without_operand<str_float_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        static const std::regex e("[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?");
-        return regex_match(a,e)==b;
+        // same as regex_match(a,"[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?")
+        return detail::is_float(string_view(a))==b;
     }
 };
 
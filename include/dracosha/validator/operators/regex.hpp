@@ -23,12 +23,68 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/regex.hpp>
 
 #include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/utils/regex_cache.hpp>
 #include <dracosha/validator/operators/operator.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+/**
+ * @brief Helper to get regular expression from operand.
+ *
+ * Default implementation compiles expression every time.
+ */
+template <typename T, typename=hana::when<true>>
+struct regex_operand_t
+{
+    template <typename T1>
+    std::regex operator() (const T1& b) const
+    {
+        return std::regex(b);
+    }
+};
+
+/**
+ * @brief Helper to get regular expression from string operand.
+ *
+ * Expression is compiled only once and then taken from process wide regex_cache.
+ */
+template <typename T>
+struct regex_operand_t<T,hana::when<std::is_constructible<string_view,const T&>::value>>
+{
+    template <typename T1>
+    regex_cache::regex_ptr operator() (const T1& b) const
+    {
+        return regex_cache::instance().get(string_view(b));
+    }
+};
+
+template <typename T>
+auto regex_operand(const T& b)
+{
+    return regex_operand_t<T>{}(b);
+}
+
+template <typename T>
+const std::regex& regex_ref(const T& rx) noexcept
+{
+    return rx;
+}
+
+inline const std::regex& regex_ref(const regex_cache::regex_ptr& rx) noexcept
+{
+    return *rx;
+}
+
+}
+
+//-------------------------------------------------------------
+
 /**
  * @brief Definition of operator "match regular expression".
  */
@@ -38,9 +94,10 @@ struct regex_match_t : public op<regex_match_t>
     constexpr static const char* n_description="must not match expression";
 
     template <typename T1, typename T2>
-    constexpr bool operator() (const T1& a, const T2& b) const
+    bool operator() (const T1& a, const T2& b) const
     {
-        return std::regex_match(a,std::regex(b));
+        auto rx=detail::regex_operand(b);
+        return std::regex_match(a,detail::regex_ref(rx));
     }
 
     template <typename T1>
@@ -90,9 +147,10 @@ struct regex_contains_t : public op<regex_contains_t>
     constexpr static const char* n_description="must not contain expression";
 
     template <typename T1, typename T2>
-    constexpr bool operator() (const T1& a, const T2& b) const
+    bool operator() (const T1& a, const T2& b) const
     {
-        return std::regex_search(a,std::regex(b));
+        auto rx=detail::regex_operand(b);
+        return std::regex_search(a,detail::regex_ref(rx));
     }
 
     template <typename T1>
@@ -19,12 +19,11 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef DRACOSHA_VALIDATOR_STRING_PATTERNS_HPP
 #define DRACOSHA_VALIDATOR_STRING_PATTERNS_HPP
 
-#include <boost/regex.hpp>
-
 #include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/detail/string_scanners.hpp>
 #include <dracosha/validator/operators/operator.hpp>
 #include <dracosha/validator/operators/op_report_without_operand.hpp>
-#include <dracosha/validator/operators/regex.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -41,8 +40,8 @@ struct str_alpha_t : public op_report_without_operand<str_alpha_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        static const std::regex e("[0-9a-zA-Z_]*");
-        return regex_match(a,e)==b;
+        // same as regex_match(a,"[0-9a-zA-Z_]*")
+        return detail::all_chars_of_class<detail::char_class::word>(string_view(a))==b;
     }
 };
 
@@ -62,8 +61,9 @@ struct str_hex_t : public op_report_without_operand<str_hex_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        static const std::regex e("[0-9a-fA-F]+");
-        return regex_match(a,e)==b;
+        // same as regex_match(a,"[0-9a-fA-F]+")
+        string_view str(a);
+        return (!str.empty() && detail::all_chars_of_class<detail::char_class::hex>(str))==b;
     }
 };
 
@@ -0,0 +1,438 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/path_trie.hpp
+*
+*  Defines runtime prefix tree of member paths used for paths filtering.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_PATH_TRIE_HPP
+#define DRACOSHA_VALIDATOR_PATH_TRIE_HPP
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/property.hpp>
+#include <dracosha/validator/member_path.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/utils/unwrap_object.hpp>
+#include <dracosha/validator/detail/member_path_key.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+struct element_aggregation_tag;
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Kind of key of member path in path trie.
+ */
+enum class path_trie_key : int
+{
+    regular, //!< Key is encoded and matches only equal keys.
+    wildcard, //!< Key of element aggregation that matches any key.
+    unsupported //!< Key can not be encoded.
+};
+
+/**
+ * @brief Default helper for encoding a key of member path, used for keys that can not be encoded.
+ */
+template <typename T, typename =hana::when<true>>
+struct path_trie_key_t
+{
+    constexpr static const bool supported=false;
+
+    path_trie_key operator() (std::string&, const T&) const noexcept
+    {
+        return path_trie_key::unsupported;
+    }
+};
+
+/**
+ * @brief Helper for encoding integral key of member path.
+ *
+ * Integral keys of different types are encoded the same way if they have equal values.
+ */
+template <typename T>
+struct path_trie_key_t<T,hana::when<std::is_integral<T>::value>>
+{
+    constexpr static const bool supported=true;
+
+    path_trie_key operator() (std::string& dst, const T& id) const
+    {
+        if (is_negative(id,std::is_signed<T>{}))
+        {
+            auto val=static_cast<int64_t>(id);
+            dst.push_back('n');
+            dst.append(reinterpret_cast<const char*>(&val),sizeof(val));
+        }
+        else
+        {
+            auto val=static_cast<uint64_t>(id);
+            dst.push_back('u');
+            dst.append(reinterpret_cast<const char*>(&val),sizeof(val));
+        }
+        return path_trie_key::regular;
+    }
+
+    private:
+
+        static bool is_negative(const T& id, std::true_type) noexcept
+        {
+            return id<0;
+        }
+
+        static bool is_negative(const T&, std::false_type) noexcept
+        {
+            return false;
+        }
+};
+
+/**
+ * @brief Helper for encoding string key of member path.
+ */
+template <typename T>
+struct path_trie_key_t<T,hana::when<
+            std::is_constructible<string_view,T>::value
+            &&
+            !hana::is_a<property_tag,T>
+        >>
+{
+    constexpr static const bool supported=true;
+
+    path_trie_key operator() (std::string& dst, const T& id) const
+    {
+        string_view str(id);
+        dst.push_back('s');
+        dst.append(str.data(),str.size());
+        return path_trie_key::regular;
+    }
+};
+
+/**
+ * @brief Helper for encoding stateless property key of member path.
+ *
+ * Property is encoded by its type.
+ */
+template <typename T>
+struct path_trie_key_t<T,hana::when<
+            hana::is_a<property_tag,T>
+            &&
+            std::is_empty<T>::value
+        >>
+{
+    constexpr static const bool supported=true;
+
+    path_trie_key operator() (std::string& dst, const T&) const
+    {
+        static const char tag=0;
+        const void* ptr=&tag;
+        dst.push_back('p');
+        dst.append(reinterpret_cast<const char*>(&ptr),sizeof(ptr));
+        return path_trie_key::regular;
+    }
+};
+
+/**
+ * @brief Helper for encoding key of element aggregation, such keys match any key.
+ */
+template <typename T>
+struct path_trie_key_t<T,hana::when<
+            is_element_aggregation_key<T>::value
+            ||
+            hana::is_a<element_aggregation_tag,T>
+        >>
+{
+    constexpr static const bool supported=true;
+
+    path_trie_key operator() (std::string&, const T&) const noexcept
+    {
+        return path_trie_key::wildcard;
+    }
+};
+
+}
+
+//-------------------------------------------------------------
+
+struct path_trie_tag{};
+
+/**
+ * @brief Runtime prefix tree of member paths.
+ *
+ * Path trie is used as a list of paths for partial validation, see include_paths() and exclude_paths().
+ * Checking if a path starts with one of the paths in the trie takes time proportional to the depth of the path
+ * and does not depend on the number of paths in the trie, so the trie is suitable for very large lists of paths.
+ *
+ * Keys of paths can be strings, integers, stateless properties and element aggregations such as ALL or ANY.
+ * Element aggregations match any key the same way as they do in lists of paths.
+ *
+ * Copies of the trie share the same nodes until one of the copies is modified, the modified copy gets its own nodes then.
+ * Thus, adding paths to a trie does not affect copies of the trie already used by adapters.
+ * The same trie object must not be modified concurrently with other operations on it.
+ */
+class path_trie
+{
+    public:
+
+        using hana_tag=path_trie_tag;
+
+        /**
+         * @brief Constructor of empty trie.
+         */
+        path_trie()
+            : _data(std::make_shared<data>())
+        {}
+
+        /**
+         * @brief Constructor from list of paths.
+         * @param paths List of paths made with member_path_list().
+         */
+        template <typename ...Paths>
+        explicit path_trie(const hana::tuple<Paths...>& paths)
+            : path_trie()
+        {
+            hana::for_each(
+                paths,
+                [this](const auto& path)
+                {
+                    add(path);
+                }
+            );
+        }
+
+        /**
+         * @brief Add path to the trie.
+         * @param path Either member or member path or a single key of member path.
+         */
+        template <typename T>
+        void add(const T& path)
+        {
+            detach();
+            add_path(
+                hana::if_(
+                    hana::is_a<hana::tuple_tag,T>,
+                    [](const auto& path) -> decltype(auto)
+                    {
+                        return hana::id(path);
+                    },
+                    [](const auto& member)
+                    {
+                        return member_path(member);
+                    }
+                )(path)
+            );
+        }
+
+        /**
+         * @brief Check if path starts with one of the paths in the trie.
+         * @param path Member path.
+         * @return Boolean result.
+         */
+        template <typename PathT>
+        bool has_prefix_of(const PathT& path) const
+        {
+            // buffers are reused in order to avoid allocations on each lookup
+            static thread_local std::string key;
+            static thread_local std::vector<const node*> current;
+            static thread_local std::vector<const node*> next;
+
+            current.clear();
+            current.push_back(&_data->root);
+            bool found=_data->root.terminal;
+            hana::for_each(
+                path,
+                [&](const auto& path_key)
+                {
+                    if (found || current.empty())
+                    {
+                        return;
+                    }
+
+                    using key_type=unwrap_object_t<decltype(path_key)>;
+                    key.clear();
+                    auto kind=detail::path_trie_key_t<key_type>{}(key,unwrap_object(path_key));
+
+                    next.clear();
+                    for (auto&& n : current)
+                    {
+                        if (kind==detail::path_trie_key::wildcard)
+                        {
+                            for (auto&& it : n->children)
+                            {
+                                next.push_back(it.second.get());
+                            }
+                        }
+                        else if (kind==detail::path_trie_key::regular)
+                        {
+                            auto it=n->children.find(key);
+                            if (it!=n->children.end())
+                            {
+                                next.push_back(it->second.get());
+                            }
+                        }
+                        if (n->any)
+                        {
+                            next.push_back(n->any.get());
+                        }
+                    }
+                    for (auto&& n : next)
+                    {
+                        if (n->terminal)
+                        {
+                            found=true;
+                            break;
+                        }
+                    }
+                    std::swap(current,next);
+                }
+            );
+            return found;
+        }
+
+        /**
+         * @brief Get number of paths in the trie.
+         * @return Number of paths.
+         */
+        size_t size() const noexcept
+        {
+            return _data->size;
+        }
+
+        /**
+         * @brief Check if trie is empty.
+         * @return True if there are no paths in the trie.
+         */
+        bool empty() const noexcept
+        {
+            return _data->size==0;
+        }
+
+    private:
+
+        struct node
+        {
+            node()=default;
+            ~node()=default;
+            node(node&&)=default;
+            node& operator= (const node&)=delete;
+            node& operator= (node&&)=default;
+
+            /**
+             * @brief Deep copy of node.
+             */
+            node(const node& other)
+                : any(other.any ? new node(*other.any) : nullptr),
+                  terminal(other.terminal)
+            {
+                children.reserve(other.children.size());
+                for (auto&& it : other.children)
+                {
+                    children.emplace(it.first,std::unique_ptr<node>(new node(*it.second)));
+                }
+            }
+
+            std::unordered_map<std::string,std::unique_ptr<node>> children;
+            std::unique_ptr<node> any;
+            bool terminal=false;
+        };
+
+        struct data
+        {
+            node root;
+            size_t size=0;
+        };
+
+        void detach()
+        {
+            if (_data.use_count()>1)
+            {
+                _data=std::make_shared<data>(*_data);
+            }
+        }
+
+        template <typename PathT>
+        void add_path(const PathT& path)
+        {
+            node* n=&_data->root;
+            std::string key;
+            hana::for_each(
+                path,
+                [&](const auto& path_key)
+                {
+                    using key_type=unwrap_object_t<decltype(path_key)>;
+                    static_assert(detail::path_trie_key_t<key_type>::supported,"Unsupported key type of member path");
+
+                    key.clear();
+                    auto kind=detail::path_trie_key_t<key_type>{}(key,unwrap_object(path_key));
+                    if (kind==detail::path_trie_key::wildcard)
+                    {
+                        if (!n->any)
+                        {
+                            n->any.reset(new node());
+                        }
+                        n=n->any.get();
+                    }
+                    else
+                    {
+                        auto& child=n->children[key];
+                        if (!child)
+                        {
+                            child.reset(new node());
+                        }
+                        n=child.get();
+                    }
+                }
+            );
+            if (!n->terminal)
+            {
+                n->terminal=true;
+                ++_data->size;
+            }
+        }
+
+        std::shared_ptr<data> _data;
+};
+
+/**
+ * @brief Build path trie from members.
+ * @param args Members or member paths or single keys of member paths.
+ * @return Path trie.
+ */
+template <typename ...Args>
+path_trie make_path_trie(Args&&... args)
+{
+    path_trie trie;
+    hana::for_each(
+        hana::make_tuple(std::cref(args)...),
+        [&trie](const auto& arg)
+        {
+            trie.add(arg.get());
+        }
+    );
+    return trie;
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_PATH_TRIE_HPP
@@ -22,13 +22,15 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/member_with_name_list.hpp>
 #include <dracosha/validator/prepend_super_member.hpp>
+#include <dracosha/validator/utils/wrap_object.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 template <typename SuperMemberT, typename MemberT>
 auto prepend_super_member(SuperMemberT&& super, MemberT&& member)
 {
-    auto new_path=hana::concat(super.path(),member.path());
+    // keys of new path refer to keys of original members to avoid copying them
+    auto new_path=hana::concat(wrap_path_refs(super.path()),wrap_path_refs(member.path()));
 
     return hana::eval_if(
         hana::or_(
@@ -21,8 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <dracosha/validator/validate.hpp>
 #include <dracosha/validator/utils/get_it.hpp>
-#include <dracosha/validator/prevalidation/validate_empty.hpp>
-#include <dracosha/validator/prevalidation/validate_value.hpp>
+#include <dracosha/validator/prevalidation/validate_implications.hpp>
 #include <dracosha/validator/prevalidation/true_if_empty.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
@@ -75,6 +74,8 @@ void clear_member(
  * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
  * @param err Validation result.
  *
+ * Emptiness, size and elements of the member are prevalidated in a single pass of the validator.
+ *
  * @note Use with caution. Only "size", "length" and "empty" properties as well as comparison and lexicographical operators
  * are validated. If other operators are used to validate content, then they are not checked.
  * For example, clearing string validated with `validator(_[string_field](regex_match,"Hello world!"))`
@@ -88,14 +89,18 @@ void clear_validated(
         error_report& err
     )
 {
-    validate_empty(std::forward<MemberT>(member),std::forward<ValidatorT>(validator),err);
+    validate_implications(
+        hana::make_tuple(
+            make_prevalidation_implication(member[empty],true),
+            make_prevalidation_implication(member[size],0),
+            make_prevalidation_implication(member,true_if_empty)
+        ),
+        std::forward<ValidatorT>(validator),
+        err
+    );
     if (!err)
     {
-        validate_value(std::forward<MemberT>(member),true_if_empty,std::forward<ValidatorT>(validator),err);
-        if (!err)
-        {
-            clear_member(obj,member);
-        }
+        clear_member(obj,member);
     }
 }
 
@@ -0,0 +1,614 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/prevalidation/combined_prevalidation_adapter_impl.hpp
+*
+*  Defines implementation of adapter for prevalidation of a number of member implications in a single pass.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_COMBINED_PREVALIDATION_ADAPTER_IMPL_HPP
+#define DRACOSHA_VALIDATOR_COMBINED_PREVALIDATION_ADAPTER_IMPL_HPP
+
+#include <string>
+#include <vector>
+#include <iterator>
+#include <functional>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/status.hpp>
+#include <dracosha/validator/apply.hpp>
+#include <dracosha/validator/adapter.hpp>
+#include <dracosha/validator/path_trie.hpp>
+#include <dracosha/validator/utils/object_wrapper.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/adapters/impl/default_adapter_impl.hpp>
+#include <dracosha/validator/prevalidation/prevalidation_adapter_impl.hpp>
+#include <dracosha/validator/prevalidation/strict_any.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Traits of adapter that wraps value of prevalidation implication.
+ */
+template <typename T>
+class prevalidation_value_traits : public adapter_traits,
+                                   public object_wrapper<T>
+{
+    public:
+
+        using object_wrapper<T>::object_wrapper;
+};
+
+/**
+ * @brief Implication of member modification to be prevalidated.
+ *
+ * Implication is a member that is affected by modification and a value the member will be validated with,
+ * e.g. resizing of a member implies that member[size] will be equal to the new size.
+ */
+template <typename CheckMemberT, typename T>
+class prevalidation_implication
+{
+    public:
+
+        using impl_type=prevalidation_adapter_impl<CheckMemberT>;
+        using adapter_type=adapter<prevalidation_value_traits<T>>;
+
+        /**
+         * @brief Constructor.
+         * @param member Member affected by modification.
+         * @param val Value to validate the member with.
+         */
+        prevalidation_implication(
+                CheckMemberT&& member,
+                T&& val
+            ) : _impl(std::forward<CheckMemberT>(member)),
+                _adapter(std::forward<T>(val))
+        {}
+
+        /**
+         * @brief Get prevalidation implementer of the implication.
+         */
+        const impl_type& impl() const noexcept
+        {
+            return _impl;
+        }
+
+        /**
+         * @brief Get prevalidation implementer of the implication.
+         */
+        impl_type& impl() noexcept
+        {
+            return _impl;
+        }
+
+        /**
+         * @brief Get adapter wrapping value of the implication.
+         */
+        const adapter_type& value_adapter() const noexcept
+        {
+            return _adapter;
+        }
+
+    private:
+
+        impl_type _impl;
+        adapter_type _adapter;
+};
+
+/**
+ * @brief Create implication of member modification.
+ * @param member Member affected by modification.
+ * @param val Value to validate the member with.
+ * @return Implication.
+ */
+template <typename MemberT, typename T>
+auto make_prevalidation_implication(MemberT&& member, T&& val)
+{
+    using key_type=decltype(member.key());
+    using value_type=decltype(adjust_view_type(std::forward<T>(val)));
+
+    return hana::eval_if(
+        hana::and_(
+           hana::is_a<range_tag,unwrap_object_t<T>>,
+           !hana::is_a<element_aggregation_tag,unwrap_object_t<key_type>>
+        ),
+        [&](auto&& _)
+        {
+            using member_type=decltype(_(member)[ALL]);
+            return prevalidation_implication<member_type,value_type>(member[ALL],adjust_view_type(std::forward<T>(val)));
+        },
+        [&](auto&&)
+        {
+            return prevalidation_implication<MemberT,value_type>(std::forward<MemberT>(member),adjust_view_type(std::forward<T>(val)));
+        }
+    );
+}
+
+namespace detail
+{
+
+/**
+ * @brief Invoke handler for each element of either hana::tuple or container.
+ * @param items Either hana::tuple or container of items of the same type.
+ * @param fn Handler.
+ */
+template <typename ItemsT, typename FnT>
+void for_each_tuple_or_range(ItemsT& items, FnT&& fn)
+{
+    hana::eval_if(
+        hana::Foldable<std::decay_t<ItemsT>>{},
+        [&](auto&& _)
+        {
+            hana::for_each(_(items),fn);
+        },
+        [&](auto&& _)
+        {
+            for (auto&& item : _(items))
+            {
+                fn(item);
+            }
+        }
+    );
+}
+
+/**
+ * @brief Get the first implication from hana::tuple of implications.
+ */
+template <typename ...Implications>
+const auto& front_implication(const hana::tuple<Implications...>& implications)
+{
+    return hana::front(implications);
+}
+
+/**
+ * @brief Get the first implication from container of implications.
+ */
+template <typename ContainerT>
+const auto& front_implication(const ContainerT& implications)
+{
+    return implications.front();
+}
+
+/**
+ * @brief Check if key of member path is a property implied by modification of the parent member.
+ *
+ * Implications of a member modification check the member itself as well as its size, emptiness and existence.
+ */
+template <typename T>
+using is_implied_member_key=std::integral_constant<bool,
+        std::is_same<T,std::decay_t<decltype(size)>>::value
+        ||
+        std::is_same<T,std::decay_t<decltype(empty)>>::value
+        ||
+        std::is_same<T,std::decay_t<decltype(exists)>>::value
+    >;
+
+/**
+ * @brief Make binary key of member path used for matching implications with checked members.
+ * @param dst Destination buffer.
+ * @param path Member path.
+ * @return False if the path can not be encoded, e.g. if it contains keys of element aggregations.
+ *
+ * The last key is skipped if it is size, empty or exists, so that a member and its implied properties have the same key.
+ */
+template <typename PathT>
+bool implication_path_key(std::string& dst, const PathT& path)
+{
+    bool ok=true;
+    size_t i=0;
+    constexpr size_t last=decltype(hana::size(path))::value-1;
+    hana::for_each(
+        path,
+        [&](const auto& path_key)
+        {
+            using key_type=std::decay_t<unwrap_object_t<decltype(path_key)>>;
+            if (!ok || (i++==last && is_implied_member_key<key_type>::value))
+            {
+                return;
+            }
+            ok=path_trie_key_t<key_type>{}(dst,unwrap_object(path_key))==path_trie_key::regular;
+        }
+    );
+    return ok;
+}
+
+/**
+ * @brief Index of implications given as a container.
+ *
+ * Implications are placed to hash table by paths of their members, so that each check of the validator
+ * is performed only for implications that can affect the checked member. Implications colliding in the table
+ * are filtered out by the check itself. Implications with paths that can not be encoded, e.g. with keys of element aggregations,
+ * are checked always.
+ *
+ * Index is built on demand after a few checks of members, so that small validators do not pay for building the index.
+ */
+class implications_index
+{
+    public:
+
+        /**
+         * @brief Number of checks of members performed without index before the index is built.
+         */
+        constexpr static const size_t checks_before_index=8;
+
+        /**
+         * @brief Invoke handler for indexes of implications that can affect the member.
+         * @param implications Container of implications.
+         * @param member Checked member.
+         * @param fn Handler invoked with index of implication, iteration stops when handler returns false.
+         * @return False if the member can not be matched with the index, in that case all implications must be checked.
+         *
+         * Implications are visited in the order they are placed in the container.
+         */
+        template <typename ImplicationsT, typename MemberT, typename FnT>
+        bool each(const ImplicationsT& implications, const MemberT& member, FnT&& fn) const
+        {
+            // buffer of key is reused in order to avoid allocations on each lookup
+            static thread_local std::string key;
+            key.clear();
+            if (!implication_path_key(key,member.path()))
+            {
+                return false;
+            }
+            if (!_built)
+            {
+                if (++_checks<=checks_before_index)
+                {
+                    return false;
+                }
+                build(implications);
+            }
+
+            // merge ordered lists of indexed and unindexed implications
+            auto it1=_buckets[std::hash<std::string>{}(key)&(_buckets.size()-1)];
+            auto it2=_unindexed.begin();
+            while (it1!=npos || it2!=_unindexed.end())
+            {
+                size_t i=0;
+                if (it2==_unindexed.end() || (it1!=npos && it1<*it2))
+                {
+                    i=it1;
+                    it1=_next[it1];
+                }
+                else
+                {
+                    i=*it2++;
+                }
+                if (!fn(i))
+                {
+                    break;
+                }
+            }
+            return true;
+        }
+
+    private:
+
+        constexpr static const size_t npos=static_cast<size_t>(-1);
+
+        template <typename ImplicationsT>
+        void build(const ImplicationsT& implications) const
+        {
+            size_t count=std::distance(std::begin(implications),std::end(implications));
+            size_t buckets=1;
+            while (buckets<count*2)
+            {
+                buckets<<=1;
+            }
+            _buckets.assign(buckets,npos);
+
+            // hashes of paths are kept in _next until chains of buckets are linked
+            _next.resize(count);
+            std::string key;
+            size_t i=0;
+            for (auto&& implication : implications)
+            {
+                key.clear();
+                if (implication_path_key(key,implication.impl().check_member().path()))
+                {
+                    _next[i]=std::hash<std::string>{}(key)&(buckets-1);
+                }
+                else
+                {
+                    _next[i]=npos;
+                    _unindexed.push_back(i);
+                }
+                ++i;
+            }
+
+            // link chains in reverse order, so that implications in each chain are ordered by index
+            for (i=count;i>0;i--)
+            {
+                auto bucket=_next[i-1];
+                if (bucket!=npos)
+                {
+                    _next[i-1]=_buckets[bucket];
+                    _buckets[bucket]=i-1;
+                }
+            }
+            _built=true;
+        }
+
+        mutable bool _built=false;
+        mutable size_t _checks=0;
+        mutable std::vector<size_t> _buckets;
+        mutable std::vector<size_t> _next;
+        mutable std::vector<size_t> _unindexed;
+};
+
+}
+
+/**
+ * @brief Implementation of adapter for prevalidation of a number of implications in a single pass.
+ *
+ * Each check of the validator is performed for each implication the same way as it is done by prevalidation_adapter_impl.
+ * Check fails if it fails for at least one implication, check is ignored if it is ignored for all implications.
+ * Thus, the validator is traversed only once regardless of the number of implications.
+ *
+ * Implications can be either a hana::tuple or a container of implications of the same type,
+ * the latter is used when the number of implications is known only at runtime.
+ * Containers of implications are indexed by member paths, so a check of a member is performed only for implications
+ * of that member and the cost of a check does not depend on the number of implications.
+ * Since the index is built during validation, the adapter must not be used for validation in a few threads at the same time.
+ */
+template <typename ImplicationsT>
+class combined_prevalidation_adapter_impl : public strict_any_tag
+{
+    public:
+
+        combined_prevalidation_adapter_impl(ImplicationsT&& implications)
+            : _implications(std::forward<ImplicationsT>(implications))
+        {}
+
+        template <typename AdapterT, typename T2, typename OpT>
+        status validate_operator(AdapterT&&, OpT&& op, T2&& b) const
+        {
+            return combine(
+                [&](const auto& implication)
+                {
+                    return implication.impl().validate_operator(implication.value_adapter(),op,b);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT>
+        status validate_property(AdapterT&&, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            return combine(
+                [&](const auto& implication)
+                {
+                    return implication.impl().validate_property(implication.value_adapter(),prop,op,b);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename MemberT>
+        status validate_exists(AdapterT&&, MemberT&& member, OpT&& op, T2&& b, bool from_check_member=false, bool skip_check=false) const
+        {
+            return combine(
+                member,
+                [&](const auto& implication)
+                {
+                    return implication.impl().validate_exists(implication.value_adapter(),member,op,b,from_check_member,skip_check);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate(AdapterT&&, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            return combine(
+                member,
+                [&](const auto& implication)
+                {
+                    return implication.impl().validate(implication.value_adapter(),member,prop,op,b);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_other_member(AdapterT&&, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            return combine(
+                member,
+                [&](const auto& implication)
+                {
+                    return implication.impl().validate_with_other_member(implication.value_adapter(),member,prop,op,b);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_master_sample(AdapterT&&, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            return combine(
+                member,
+                [&](const auto& implication)
+                {
+                    return implication.impl().validate_with_master_sample(implication.value_adapter(),member,prop,op,b);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename OpsT>
+        status validate_and(AdapterT&& adpt, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_and(std::forward<AdapterT>(adpt),std::forward<OpsT>(ops));
+        }
+
+        template <typename PredicateT, typename AdapterT, typename OpsT, typename MemberT>
+        static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT&& member, OpsT&& ops)
+        {
+            return while_each(
+                      ops,
+                      pred,
+                      status(status::code::ignore),
+                      [&member,&adapter](auto&& op)
+                      {
+                        return status(
+                                    apply_member(
+                                        adapter,
+                                        std::forward<decltype(op)>(op),
+                                        member
+                                    )
+                                 );
+                      }
+                  );
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpsT>
+        status validate_and(AdapterT&& adapter, MemberT&& member, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_and(std::forward<AdapterT>(adapter),std::forward<MemberT>(member),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename OpsT>
+        status validate_or(AdapterT&& adpt, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_or(std::forward<AdapterT>(adpt),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpsT>
+        status validate_or(AdapterT&& adapter, MemberT&& member, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_or(std::forward<AdapterT>(adapter),std::forward<MemberT>(member),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename OpT>
+        status validate_not(AdapterT&& adpt, OpT&& op) const
+        {
+            return default_adapter_impl::validate_not(std::forward<AdapterT>(adpt),std::forward<OpT>(op));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpT>
+        status validate_not(AdapterT&& adapter, MemberT&& member, OpT&& op) const
+        {
+            bool filtered=true;
+            detail::for_each_tuple_or_range(
+                _implications,
+                [&](const auto& implication)
+                {
+                    filtered=filtered && implication.impl().filter_member_with_size(member);
+                }
+            );
+            if (filtered)
+            {
+                return status(status::code::ignore);
+            }
+            return status(!apply_member(adapter,std::forward<decltype(op)>(op),member));
+        }
+
+        /**
+         * @brief Enable or disable strict ANY validation for all implications.
+         * @param enable Flag.
+         */
+        void set_strict_any(bool enable) noexcept
+        {
+            strict_any_tag::set_strict_any(enable);
+            detail::for_each_tuple_or_range(
+                _implications,
+                [enable](auto& implication)
+                {
+                    implication.impl().set_strict_any(enable);
+                }
+            );
+        }
+
+        /**
+         * @brief Get value of the first implication.
+         */
+        const auto& value() const
+        {
+            return traits_of(detail::front_implication(_implications).value_adapter()).get();
+        }
+
+    private:
+
+        /**
+         * @brief Combine results of a check performed for each implication.
+         *
+         * Implications are checked until the first failure.
+         */
+        template <typename FnT>
+        status combine(FnT&& fn) const
+        {
+            status result(status::code::ignore);
+            detail::for_each_tuple_or_range(
+                _implications,
+                [&](const auto& implication)
+                {
+                    if (result.value()==status::code::fail)
+                    {
+                        return;
+                    }
+                    status ok=fn(implication);
+                    if (ok.value()!=status::code::ignore)
+                    {
+                        result=ok;
+                    }
+                }
+            );
+            return result;
+        }
+
+        /**
+         * @brief Combine results of a check of member performed for each implication that can affect the member.
+         *
+         * Implications in container are looked up in the index, implications in hana::tuple are all checked.
+         */
+        template <typename MemberT, typename FnT>
+        status combine(const MemberT& member, FnT&& fn) const
+        {
+            return hana::eval_if(
+                hana::Foldable<std::decay_t<ImplicationsT>>{},
+                [&](auto&& _)
+                {
+                    return _(this)->combine(fn);
+                },
+                [&](auto&& _)
+                {
+                    status result(status::code::ignore);
+                    const auto& implications=_(_implications);
+                    bool indexed=_index.each(
+                        implications,
+                        member,
+                        [&](size_t i)
+                        {
+                            status ok=fn(*std::next(std::begin(implications),i));
+                            if (ok.value()!=status::code::ignore)
+                            {
+                                result=ok;
+                            }
+                            return result.value()!=status::code::fail;
+                        }
+                    );
+                    if (!indexed)
+                    {
+                        return _(this)->combine(fn);
+                    }
+                    return result;
+                }
+            );
+        }
+
+        ImplicationsT _implications;
+        detail::implications_index _index;
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_COMBINED_PREVALIDATION_ADAPTER_IMPL_HPP
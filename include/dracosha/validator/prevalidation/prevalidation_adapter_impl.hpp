@@ -401,14 +401,11 @@ class prevalidation_adapter_impl : public strict_any_tag
             return _mmember.get();
         }
 
-    private:
-
-        template <typename MemberT>
-        bool filter_member(const MemberT& member) const noexcept
-        {
-            return !check_member().equals(member);
-        }
-
+        /**
+         * @brief Check if neither the member nor its size or emptiness matches the check member.
+         * @param member Member to check.
+         * @return True if the member must be filtered out.
+         */
         template <typename MemberT>
         bool filter_member_with_size(const MemberT& member) const noexcept
         {
@@ -419,6 +416,14 @@ class prevalidation_adapter_impl : public strict_any_tag
                filter_member(member[empty]);
         }
 
+    private:
+
+        template <typename MemberT>
+        bool filter_member(const MemberT& member) const noexcept
+        {
+            return !check_member().equals(member);
+        }
+
         object_wrapper<CheckMemberT> _mmember;
         mutable bool _member_checked;
 };
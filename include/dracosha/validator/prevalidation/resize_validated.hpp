@@ -23,7 +23,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/check_exists.hpp>
 #include <dracosha/validator/get_member.hpp>
 #include <dracosha/validator/prevalidation/true_if_size.hpp>
-#include <dracosha/validator/prevalidation/validate_value.hpp>
+#include <dracosha/validator/prevalidation/validate_implications.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -79,6 +79,8 @@ void resize_member(
  * @param validator Validator to use for validation.
  * @param err Validation result.
  *
+ * Size, emptiness and elements of the member are prevalidated in a single pass of the validator.
+ *
  * @note Use with caution. Only "size", "length" and "empty" properties as well as comparison and lexicographical operators
  * are validated. If other operators are used to validate content, then they are not checked.
  * For example, resizing string validated with `validator(_[string_field](regex_match,"Hello world!"))`
@@ -93,18 +95,18 @@ void resize_validated(
         error_report& err
     )
 {
-    validate(member[size],wrap_strict_any(val,validator),extract_strict_any(validator),err);
+    validate_implications(
+        hana::make_tuple(
+            make_prevalidation_implication(member[size],val),
+            make_prevalidation_implication(member[empty],val==0),
+            make_prevalidation_implication(member,true_if_size{static_cast<size_t>(val)})
+        ),
+        std::forward<ValidatorT>(validator),
+        err
+    );
     if (!err)
     {
-        validate(member[empty],wrap_strict_any(val==0,validator),extract_strict_any(validator),err);
-        if (!err)
-        {
-            validate_value(std::forward<MemberT>(member),true_if_size{static_cast<size_t>(val)},std::forward<ValidatorT>(validator),err);
-            if (!err)
-            {
-                resize_member(obj,member,val);
-            }
-        }
+        resize_member(obj,member,val);
     }
 }
 
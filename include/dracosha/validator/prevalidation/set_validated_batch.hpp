@@ -0,0 +1,178 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/prevalidation/set_validated_batch.hpp
+*
+*  Defines "set_validated_batch" helpers.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_SET_VALIDATED_BATCH_HPP
+#define DRACOSHA_VALIDATOR_SET_VALIDATED_BATCH_HPP
+
+#include <vector>
+
+#include <dracosha/validator/prevalidation/set_validated.hpp>
+#include <dracosha/validator/prevalidation/validate_implications.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Edit of object's member to be set in a batch.
+ */
+template <typename MemberT, typename ValueT>
+struct member_edit
+{
+    MemberT member;
+    ValueT value;
+};
+
+/**
+ * @brief Create edit of object's member.
+ * @param member Member name.
+ * @param val Value to set.
+ * @return Edit.
+ */
+template <typename MemberT, typename ValueT>
+auto make_member_edit(MemberT&& member, ValueT&& val)
+{
+    return member_edit<std::decay_t<MemberT>,std::decay_t<ValueT>>{std::forward<MemberT>(member),std::forward<ValueT>(val)};
+}
+
+namespace detail
+{
+
+/**
+ * @brief Make implications of edits given as hana::tuple.
+ */
+template <typename ...Edits>
+auto make_edit_implications(const hana::tuple<Edits...>& edits)
+{
+    return hana::transform(
+        edits,
+        [](const auto& edit)
+        {
+            return make_prevalidation_implication(edit.member,edit.value);
+        }
+    );
+}
+
+/**
+ * @brief Make implications of edits given as container of edits of the same type.
+ */
+template <typename ContainerT>
+auto make_edit_implications(const ContainerT& edits)
+{
+    using edit_type=typename ContainerT::value_type;
+    using implication_type=decltype(make_prevalidation_implication(
+                                        std::declval<const edit_type&>().member,
+                                        std::declval<const edit_type&>().value
+                                    ));
+    std::vector<implication_type> implications;
+    implications.reserve(edits.size());
+    for (const auto& edit : edits)
+    {
+        implications.push_back(make_prevalidation_implication(edit.member,edit.value));
+    }
+    return implications;
+}
+
+/**
+ * @brief Check if batch of edits is empty.
+ */
+template <typename ...Edits>
+constexpr bool edits_empty(const hana::tuple<Edits...>&) noexcept
+{
+    return sizeof...(Edits)==0;
+}
+
+/**
+ * @brief Check if batch of edits is empty.
+ */
+template <typename ContainerT>
+bool edits_empty(const ContainerT& edits) noexcept
+{
+    return edits.empty();
+}
+
+}
+
+/**
+ * @brief Set a batch of object's members with pre-validation with validation result put in the last argument.
+ * @param obj Object whose members to set.
+ * @param edits Edits made with make_member_edit(), either hana::tuple of edits or container of edits of the same type.
+ * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+ * @param err Validation result.
+ *
+ * All edits are prevalidated in a single pass of the validator. Members are set only if all edits pass prevalidation,
+ * otherwise the object is left unchanged and the report describes the first failed check.
+ *
+ * Only prevalidation is transactional. Members are set one by one after prevalidation,
+ * if setting of a member throws then the members set before it are not rolled back.
+ */
+template <typename ObjectT, typename EditsT, typename ValidatorT>
+void set_validated_batch(
+        ObjectT& obj,
+        EditsT&& edits,
+        ValidatorT&& validator,
+        error_report& err
+    )
+{
+    if (detail::edits_empty(edits))
+    {
+        err.reset();
+        return;
+    }
+
+    validate_implications(detail::make_edit_implications(edits),std::forward<ValidatorT>(validator),err);
+    if (!err)
+    {
+        detail::for_each_tuple_or_range(
+            edits,
+            [&obj](auto&& edit)
+            {
+                set_member(obj,edit.member,edit.value);
+            }
+        );
+    }
+}
+
+/**
+ * @brief Set a batch of object's members with pre-validation with exception if validation fails.
+ * @param obj Object whose members to set.
+ * @param edits Edits made with make_member_edit(), either hana::tuple of edits or container of edits of the same type.
+ * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+ *
+ * @throws validation_error if validation fails.
+ */
+template <typename ObjectT, typename EditsT, typename ValidatorT>
+void set_validated_batch(
+        ObjectT& obj,
+        EditsT&& edits,
+        ValidatorT&& validator
+    )
+{
+    error_report err;
+    set_validated_batch(obj,std::forward<EditsT>(edits),std::forward<ValidatorT>(validator),err);
+    if (err)
+    {
+        throw validation_error(err);
+    }
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_SET_VALIDATED_BATCH_HPP
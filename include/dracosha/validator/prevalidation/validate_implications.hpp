@@ -0,0 +1,65 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/prevalidation/validate_implications.hpp
+*
+*  Defines "validate_implications" helpers.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_VALIDATE_IMPLICATIONS_HPP
+#define DRACOSHA_VALIDATOR_VALIDATE_IMPLICATIONS_HPP
+
+#include <dracosha/validator/validate.hpp>
+#include <dracosha/validator/adapters/combined_prevalidation_adapter.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+/**
+ * @brief Implementation of a helper to prevalidate a number of implications of member modification.
+ */
+struct validate_implications_t
+{
+    /**
+     * @brief Check if implications of member modification can be validated by the validator.
+     * @param implications Tuple of implications made with make_prevalidation_implication().
+     * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+     * @param err Validation result.
+     *
+     * All implications are validated in a single pass of the validator.
+     */
+    template <typename ImplicationsT, typename ValidatorT>
+    void operator() (
+            ImplicationsT&& implications,
+            ValidatorT&& validator,
+            error_report& err
+        ) const
+    {
+        err.reset();
+        err.set_value(extract_strict_any(validator).apply(
+                          make_combined_prevalidation_adapter(
+                              std::forward<ImplicationsT>(implications),
+                              err._message,
+                              hana::is_a<strict_any_tag,ValidatorT>
+                          )
+                      ));
+    }
+};
+
+/**
+ * @brief Helper to invoke validate_implications() as a single callable.
+ */
+constexpr validate_implications_t validate_implications{};
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_VALIDATE_IMPLICATIONS_HPP
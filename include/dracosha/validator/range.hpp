@@ -20,8 +20,11 @@ Distributed under the Boost Software License, Version 1.0.
 #define DRACOSHA_VALIDATOR_RANGE_HPP
 
 #include <vector>
+#include <memory>
+#include <algorithm>
 
 #include <dracosha/validator/config.hpp>
+#include <dracosha/validator/detail/range_index.hpp>
 #include <dracosha/validator/utils/enable_to_string.hpp>
 #include <dracosha/validator/reporting/format_operand.hpp>
 
@@ -37,6 +40,23 @@ using sorted_t=std::true_type;
  */
 constexpr sorted_t sorted{};
 
+/**
+ * @brief Type of flag to use as parameter for hashed ranges.
+ */
+struct hashed_t{};
+/**
+ * Flag to use as parameter for hashed ranges.
+ */
+constexpr hashed_t hashed{};
+
+/**
+ * @brief Check if type is a flag of range mode.
+ */
+template <typename T>
+using is_range_mode=std::integral_constant<bool,
+        std::is_same<std::decay_t<T>,sorted_t>::value || std::is_same<std::decay_t<T>,hashed_t>::value
+    >;
+
 /**
  * @brief Wrapper of searchable container and can be used in operators of "in" type.
  */
@@ -46,6 +66,7 @@ struct range_t
     using hana_tag=range_tag;
     using type=T;
     using is_sorted=SortedT;
+    using is_hashed=std::false_type;
 
     /**
      * @brief Constructor.
@@ -64,6 +85,125 @@ struct range_t
     size_t max_report_elements;
 };
 
+/**
+ * @brief Wrapper of searchable container with hash index of elements.
+ *
+ * Hash index is built once when the range is constructed, copies of the range share the same index.
+ * Thus, the container must not be modified after the range is constructed.
+ *
+ * Elements of string, integral, floating point and enum types are indexed. For string elements also an index
+ * of case folded strings is built to be used by case insensitive operators.
+ * If elements can not be indexed or a searched value is not compatible with the index then linear search is used.
+ */
+template <typename T>
+struct range_t<T,hashed_t>
+{
+    using hana_tag=range_tag;
+    using type=T;
+    using is_sorted=std::false_type;
+    using is_hashed=std::true_type;
+
+    using storage_type=detail::hashed_range_storage<T>;
+    using container_type=typename storage_type::container_type;
+    using value_type=typename storage_type::value_type;
+    using key_traits=typename storage_type::key_traits;
+
+    /**
+     * @brief Constructor.
+     * @param container Container to be wrapped into range.
+     * @param max_report_elements Max number of range elements to be listed in report.
+     */
+    template <typename T1,
+              typename=std::enable_if_t<!std::is_same<std::decay_t<T1>,range_t>::value>>
+    range_t(
+            T1&& container,
+            size_t max_report_elements=(std::numeric_limits<size_t>::max)()
+        ) : _storage(std::make_shared<storage_type>(std::forward<T1>(container))),
+            container(_storage->container),
+            max_report_elements(max_report_elements)
+    {}
+
+    range_t(const range_t& other)
+        : _storage(other._storage),
+          container(_storage->container),
+          max_report_elements(other.max_report_elements)
+    {}
+
+    range_t& operator= (const range_t&)=delete;
+
+    /**
+     * @brief Check if range contains element equal to value.
+     * @param a Value to look for.
+     * @param equal Equality operator.
+     * @return True if element is found.
+     */
+    template <typename T1, typename EqualT>
+    bool find(const T1& a, const EqualT& equal) const
+    {
+        return find_impl(
+                    a,equal,
+                    std::integral_constant<bool,
+                        storage_type::indexed::value && key_traits::template is_compatible<T1>::value
+                    >{}
+                );
+    }
+
+    /**
+     * @brief Check if range contains element equal to value using case insensitive equality operator.
+     * @param a Value to look for.
+     * @param iequal Case insensitive equality operator.
+     * @return True if element is found.
+     */
+    template <typename T1, typename EqualT>
+    bool ifind(const T1& a, const EqualT& iequal) const
+    {
+        return ifind_impl(
+                    a,iequal,
+                    std::integral_constant<bool,
+                        storage_type::case_folding::value && key_traits::template is_compatible<T1>::value
+                    >{}
+                );
+    }
+
+    private:
+
+        template <typename T1, typename EqualT>
+        bool find_impl(const T1& a, const EqualT& equal, std::true_type) const
+        {
+            return _storage->index.find(key_traits::hash(a),[&a,&equal](const value_type& v){return equal(a,v);});
+        }
+
+        template <typename T1, typename EqualT>
+        bool ifind_impl(const T1& a, const EqualT& iequal, std::true_type) const
+        {
+            return _storage->iindex.find(key_traits::ihash(a),[&a,&iequal](const value_type& v){return iequal(a,v);});
+        }
+
+        template <typename T1, typename EqualT>
+        bool find_impl(const T1& a, const EqualT& equal, std::false_type) const
+        {
+            return std::find_if(std::begin(container),std::end(container),
+                             [&a,&equal](const auto& v)
+                             {
+                                return equal(a,v);
+                             }
+                             )!=std::end(container);
+        }
+
+        template <typename T1, typename EqualT>
+        bool ifind_impl(const T1& a, const EqualT& iequal, std::false_type) const
+        {
+            return find_impl(a,iequal,std::false_type{});
+        }
+
+        std::shared_ptr<const storage_type> _storage;
+
+    public:
+
+        const container_type& container;
+        size_t max_report_elements;
+};
+
 /**
  * @brief Helper for building ranges.
  */
@@ -81,23 +221,23 @@ struct range_helper
     }
 
     /**
-     * @brief Make range from sorted container.
+     * @brief Make sorted or hashed range from container.
      * @param container Container to wrap in range object.
-     * @param sorted Explicit sorted value to flag that container is sorted.
-     * @return Sorted range.
+     * @param mode Explicit mode of range: sorted to flag that container is sorted or hashed to build hash index of elements.
+     * @return Sorted or hashed range.
      *
-     * Sorted ranges can use use faster lookup methods than ordinary ranges.
+     * Sorted and hashed ranges can use use faster lookup methods than ordinary ranges.
      */
     template <typename T, typename T2>
-    auto operator() (T&& container, T2 sorted,
+    auto operator() (T&& container, T2 mode,
                      std::enable_if_t<
-                        std::is_same<std::decay_t<T2>,sorted_t>::value,
+                        is_range_mode<T2>::value,
                         void*
                      > = nullptr
                      ) const
     {
-        std::ignore=sorted;
-        return range_t<T,sorted_t>(std::forward<T>(container));
+        std::ignore=mode;
+        return range_t<T,std::decay_t<T2>>(std::forward<T>(container));
     }
 
     /**
@@ -109,7 +249,7 @@ struct range_helper
     template <typename T, typename T2>
     auto operator() (T&& container, T2 max_report_elements,
                      std::enable_if_t<
-                        !std::is_same<std::decay_t<T2>,sorted_t>::value,
+                        !is_range_mode<T2>::value,
                         void*
                      > = nullptr
                      ) const
@@ -118,19 +258,24 @@ struct range_helper
     }
 
     /**
-     * @brief Make range from sorted container.
+     * @brief Make sorted or hashed range from container.
      * @param container Container to wrap in range object.
-     * @param sorted Explicit sorted value to flag that container is sorted.
+     * @param mode Explicit mode of range: sorted to flag that container is sorted or hashed to build hash index of elements.
      * @param max_report_elements Max number of range elements to be listed in report
-     * @return Sorted range.
+     * @return Sorted or hashed range.
      *
-     * Sorted ranges can use use faster lookup methods than ordinary ranges.
+     * Sorted and hashed ranges can use use faster lookup methods than ordinary ranges.
      */
-    template <typename T>
-    auto operator() (T&& container, sorted_t sorted, size_t max_report_elements) const
+    template <typename T, typename T2>
+    auto operator() (T&& container, T2 mode, size_t max_report_elements,
+                     std::enable_if_t<
+                        is_range_mode<T2>::value,
+                        void*
+                     > = nullptr
+                     ) const
     {
-        std::ignore=sorted;
-        return range_t<T,sorted_t>(std::forward<T>(container),max_report_elements);
+        std::ignore=mode;
+        return range_t<T,std::decay_t<T2>>(std::forward<T>(container),max_report_elements);
     }
 
     /**
@@ -147,23 +292,23 @@ struct range_helper
     }
 
     /**
-     * @brief Make sorted range from sorted initializer list.
+     * @brief Make sorted or hashed range from initializer list.
      * @param init Initializer list.
-     * @param sorted Explicit sorted value to flag that container is sorted.
-     * @return Sorted range.
+     * @param mode Explicit mode of range: sorted to flag that list is sorted or hashed to build hash index of elements.
+     * @return Sorted or hashed range.
      *
      * Initializer list is moved to embedded vector container of the range.
      */
     template <typename T, typename T2>
-    auto operator() (std::initializer_list<T> init, T2 sorted,
+    auto operator() (std::initializer_list<T> init, T2 mode,
                      std::enable_if_t<
-                             std::is_same<std::decay_t<T2>,sorted_t>::value,
+                             is_range_mode<T2>::value,
                              void*
                           > = nullptr
                      ) const
     {
-        std::ignore=sorted;
-        return range_t<std::vector<T>,sorted_t>(std::vector<T>{std::move(init)});
+        std::ignore=mode;
+        return range_t<std::vector<T>,std::decay_t<T2>>(std::vector<T>{std::move(init)});
     }
 
     /**
@@ -177,7 +322,7 @@ struct range_helper
     template <typename T, typename T2>
     auto operator() (std::initializer_list<T> init, T2 max_report_elements,
                      std::enable_if_t<
-                             !std::is_same<std::decay_t<T2>,sorted_t>::value,
+                             !is_range_mode<T2>::value,
                              void*
                           > = nullptr
                      ) const
@@ -186,19 +331,24 @@ struct range_helper
     }
 
     /**
-     * @brief Make sorted range from sorted initializer list.
+     * @brief Make sorted or hashed range from initializer list.
      * @param init Initializer list.
-     * @param sorted Explicit sorted value to flag that container is sorted.
+     * @param mode Explicit mode of range: sorted to flag that list is sorted or hashed to build hash index of elements.
      * @param max_report_elements Max number of range elements to be listed in report.
-     * @return Range.
+     * @return Sorted or hashed range.
      *
      * Initializer list is moved to embedded vector container of the range.
      */
-    template <typename T>
-    auto operator() (std::initializer_list<T> init, sorted_t sorted, size_t max_report_elements) const
+    template <typename T, typename T2>
+    auto operator() (std::initializer_list<T> init, T2 mode, size_t max_report_elements,
+                     std::enable_if_t<
+                             is_range_mode<T2>::value,
+                             void*
+                          > = nullptr
+                     ) const
     {
-        std::ignore=sorted;
-        return range_t<std::vector<T>,sorted_t>(std::vector<T>{std::move(init)},max_report_elements);
+        std::ignore=mode;
+        return range_t<std::vector<T>,std::decay_t<T2>>(std::vector<T>{std::move(init)},max_report_elements);
     }
 };
 constexpr range_helper range{};
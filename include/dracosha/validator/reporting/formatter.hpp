@@ -266,7 +266,7 @@ auto make_formatter(const TranslatorT& translator, const TranslateOperandsT& tra
 template <typename TranslateOperandsT=std::false_type>
 auto make_formatter(const translator_repository& rep, const std::string& loc=std::locale().name(), const TranslateOperandsT& translate_operands=std::false_type())
 {
-    const auto& translator=*rep.find_translator(loc);
+    const auto& translator=rep.get_translator(loc);
     return make_formatter(make_translated_member_names(translator),make_translated_operand_formatter(translator,translate_operands),make_translated_strings(translator));
 }
 
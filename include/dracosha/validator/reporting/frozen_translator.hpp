@@ -0,0 +1,362 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/frozen_translator.hpp
+*
+*   Defines immutable translator with hashed table of phrases.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_FROZEN_TRANSLATOR_HPP
+#define DRACOSHA_VALIDATOR_FROZEN_TRANSLATOR_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+#include <dracosha/validator/detail/range_index.hpp>
+#include <dracosha/validator/reporting/grammar_categories.hpp>
+#include <dracosha/validator/reporting/translator.hpp>
+#include <dracosha/validator/reporting/phrase_translator.hpp>
+#include <dracosha/validator/reporting/mapped_translator.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Immutable translator that keeps phrases in open addressing hash table.
+ *
+ * Frozen translator is built once from the phrases of phrase_translator or from the strings of mapped_translator
+ * and can not be modified later. Lookup of a string is a single probe of the hash table.
+ *
+ * For each string the best phrase for each combination of grammatical categories is resolved when the translator is built,
+ * the same way as phrase_translator does it, i.e. the phrase with the maximum number of matching grammatical categories is selected.
+ * Only categories used by phrases of the string affect the selection, so the table of resolved phrases is indexed by those categories only.
+ * If phrases of the string use more than max_resolved_categories categories then the best phrase is selected on lookup.
+ */
+class frozen_translator : public translator
+{
+    public:
+
+        /**
+         * @brief Maximum number of grammatical categories of a string whose selections are resolved when the translator is built.
+         */
+        constexpr static const size_t max_resolved_categories=8;
+
+        frozen_translator()=default;
+
+        /**
+         * @brief Constructor from phrases of phrase_translator.
+         * @param phrases Translated phrases.
+         */
+        explicit frozen_translator(const phrase_translator::container_type& phrases)
+        {
+            _entries.reserve(phrases.size());
+            for (auto&& it:phrases)
+            {
+                if (it.second.empty())
+                {
+                    continue;
+                }
+                entry e(it.first);
+                e.phrases.reserve(it.second.size());
+                for (auto&& phrase:it.second)
+                {
+                    e.phrases.push_back(phrase.phrase);
+                    e.phrase_cats.push_back(phrase.categories);
+                    e.cats_mask|=phrase.categories;
+                }
+                e.resolve();
+                _entries.push_back(std::move(e));
+            }
+            build_index();
+        }
+
+        /**
+         * @brief Constructor from strings of mapped_translator.
+         * @param strings Translated strings.
+         */
+        explicit frozen_translator(const std::map<std::string,std::string>& strings)
+        {
+            _entries.reserve(strings.size());
+            for (auto&& it:strings)
+            {
+                entry e(it.first);
+                e.phrases.emplace_back(it.second);
+                e.phrase_cats.push_back(0);
+                _entries.push_back(std::move(e));
+            }
+            build_index();
+        }
+
+        /**
+         * @brief Constructor from phrase translator.
+         * @param tr Phrase translator.
+         */
+        explicit frozen_translator(const phrase_translator& tr)
+            : frozen_translator(tr.phrases())
+        {}
+
+        /**
+         * @brief Constructor from mapped translator.
+         * @param tr Mapped translator.
+         */
+        explicit frozen_translator(const mapped_translator& tr)
+            : frozen_translator(tr.strings())
+        {}
+
+        ~frozen_translator()=default;
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Index refers to entries of the translator, so it is rebuilt in the copy.
+         */
+        frozen_translator(const frozen_translator& other)
+            : translator(other),
+              _entries(other._entries)
+        {
+            build_index();
+        }
+
+        frozen_translator(frozen_translator&& other)=default;
+
+        frozen_translator& operator= (const frozen_translator& other)
+        {
+            if (this!=&other)
+            {
+                translator::operator=(other);
+                _entries=other._entries;
+                build_index();
+            }
+            return *this;
+        }
+
+        frozen_translator& operator= (frozen_translator&& other)=default;
+
+        /**
+         * @brief Reset translator.
+         */
+        virtual void reset() override
+        {
+            _entries.clear();
+            build_index();
+        }
+
+        /**
+         * @brief Translate a string.
+         * @param id String id.
+         * @param cats Grammar categories to look for.
+         * @return Translated phrase or id if such string not found.
+         */
+        virtual translation_result translate(const std::string& id, grammar_categories cats=0) const override
+        {
+            auto phrase=find(id,cats);
+            if (phrase!=nullptr)
+            {
+                return translation_result{*phrase,true};
+            }
+            return translation_result{id,false};
+        }
+
+        /**
+         * @brief Find translated phrase.
+         * @param id String id.
+         * @param cats Grammar categories to look for.
+         * @return Pointer to translated phrase or nullptr if such string not found.
+         */
+        const concrete_phrase* find(string_view id, grammar_categories cats=0) const noexcept
+        {
+            auto e=find_entry(id);
+            if (e==nullptr)
+            {
+                return nullptr;
+            }
+            return &e->phrases[e->select(cats)];
+        }
+
+        /**
+         * @brief Look up translated text of a string.
+         * @param id String id.
+         * @param cats Grammar categories to look for.
+         * @return View of translated text or id if such string not found.
+         */
+        string_view lookup(string_view id, grammar_categories cats=0) const noexcept
+        {
+            auto phrase=find(id,cats);
+            if (phrase!=nullptr)
+            {
+                return string_view(phrase->text());
+            }
+            return id;
+        }
+
+        /**
+         * @brief Get number of strings in translator.
+         * @return Number of strings.
+         */
+        size_t size() const noexcept
+        {
+            return _entries.size();
+        }
+
+        /**
+         * @brief Check if translator is empty.
+         * @return Boolean flag.
+         */
+        bool empty() const noexcept
+        {
+            return _entries.empty();
+        }
+
+    private:
+
+        struct entry
+        {
+            explicit entry(const std::string& key)
+                : key(key),
+                  hash(detail::range_index_hash_string(key)),
+                  cats_mask(0)
+            {}
+
+            /**
+             * @brief Pre-resolve best phrases for all combinations of categories used by phrases.
+             */
+            void resolve()
+            {
+                if (phrases.size()==1 || count_grammar_categories(cats_mask)>max_resolved_categories)
+                {
+                    return;
+                }
+                size_t count=size_t(1)<<count_grammar_categories(cats_mask);
+                resolved.resize(count);
+                for (size_t i=0;i<count;i++)
+                {
+                    resolved[i]=static_cast<uint16_t>(select_best(expand(i)));
+                }
+            }
+
+            /**
+             * @brief Select index of the best phrase for grammar categories.
+             */
+            size_t select(grammar_categories cats) const noexcept
+            {
+                if (phrases.size()==1 || cats==0)
+                {
+                    return 0;
+                }
+                if (!resolved.empty())
+                {
+                    return resolved[compress(cats)];
+                }
+                return select_best(cats);
+            }
+
+            size_t select_best(grammar_categories cats) const noexcept
+            {
+                // the first phrase with max number of matching categories is selected as std::max_element() does
+                size_t best=0;
+                size_t best_count=count_grammar_categories(phrase_cats[0],cats);
+                for (size_t i=1;i<phrase_cats.size();i++)
+                {
+                    auto count=count_grammar_categories(phrase_cats[i],cats);
+                    if (count>best_count)
+                    {
+                        best=i;
+                        best_count=count;
+                    }
+                }
+                return best;
+            }
+
+            /**
+             * @brief Pack categories used by phrases into index of resolved table.
+             */
+            size_t compress(grammar_categories cats) const noexcept
+            {
+                size_t index=0;
+                size_t bit=1;
+                for (auto mask=cats_mask;mask!=0;mask&=static_cast<grammar_categories>(mask-1))
+                {
+                    auto lowest=static_cast<grammar_categories>(mask&(~mask+1));
+                    if (cats&lowest)
+                    {
+                        index|=bit;
+                    }
+                    bit<<=1;
+                }
+                return index;
+            }
+
+            /**
+             * @brief Unpack index of resolved table into categories.
+             */
+            grammar_categories expand(size_t index) const noexcept
+            {
+                grammar_categories cats=0;
+                size_t bit=1;
+                for (auto mask=cats_mask;mask!=0;mask&=static_cast<grammar_categories>(mask-1))
+                {
+                    auto lowest=static_cast<grammar_categories>(mask&(~mask+1));
+                    if (index&bit)
+                    {
+                        cats|=lowest;
+                    }
+                    bit<<=1;
+                }
+                return cats;
+            }
+
+            std::string key;
+            size_t hash;
+            std::vector<concrete_phrase> phrases;
+            std::vector<grammar_categories> phrase_cats;
+            grammar_categories cats_mask;
+            std::vector<uint16_t> resolved;
+        };
+
+        void build_index()
+        {
+            _index.build(_entries,[](const entry& e){return e.hash;});
+        }
+
+        const entry* find_entry(string_view id) const noexcept
+        {
+            const entry* found=nullptr;
+            _index.find(
+                detail::range_index_hash_string(id),
+                [&id,&found](const entry& e)
+                {
+                    if (string_view(e.key)==id)
+                    {
+                        found=&e;
+                        return true;
+                    }
+                    return false;
+                }
+            );
+            return found;
+        }
+
+        std::vector<entry> _entries;
+        detail::range_index<entry> _index;
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_FROZEN_TRANSLATOR_HPP
@@ -37,6 +37,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/reporting/aggregation_strings.hpp>
 #include <dracosha/validator/reporting/flag_presets.hpp>
 #include <dracosha/validator/reporting/phrase_translator.hpp>
+#include <dracosha/validator/reporting/frozen_translator.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -447,6 +448,16 @@ inline const phrase_translator& validator_translator_ru()
     return m;
 }
 
+/**
+ * @brief Get frozen translator of validator strings for Russian locale.
+ * @return Immutable translator with the same phrases as validator_translator_ru() but with faster lookups.
+ */
+inline const frozen_translator& validator_frozen_translator_ru()
+{
+    static frozen_translator tr(validator_translator_ru());
+    return tr;
+}
+
 //-------------------------------------------------------------
 
 DRACOSHA_VALIDATOR_NAMESPACE_END
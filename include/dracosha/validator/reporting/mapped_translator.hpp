@@ -83,6 +83,15 @@ class mapped_translator : public translator
             return _strings;
         }
 
+        /**
+         * @brief Get map of translated strings.
+         * @return Map of translated strings.
+         */
+        const std::map<std::string,std::string>& strings() const noexcept
+        {
+            return _strings;
+        }
+
     private:
 
         std::map<std::string,std::string> _strings;
@@ -19,6 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef DRACOSHA_VALIDATOR_MEMBER_NAMES_HPP
 #define DRACOSHA_VALIDATOR_MEMBER_NAMES_HPP
 
+#include <memory>
+
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/member_property.hpp>
 #include <dracosha/validator/reporting/translator.hpp>
@@ -27,6 +29,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/reporting/decorator.hpp>
 #include <dracosha/validator/reporting/single_member_name.hpp>
 #include <dracosha/validator/reporting/nested_member_name.hpp>
+#include <dracosha/validator/reporting/member_names_cache.hpp>
 #include <dracosha/validator/reporting/property_member_name.hpp>
 #include <dracosha/validator/reporting/decorator.hpp>
 
@@ -220,7 +223,7 @@ auto make_translated_member_names(OriginalMemberNamesT&& original_mn, translator
 template <typename OriginalMemberNamesT>
 auto make_translated_member_names(OriginalMemberNamesT&& original_mn, const translator_repository& rep, const std::string& loc=std::locale().name())
 {
-    return make_translated_member_names(std::move(original_mn),*rep.find_translator(loc));
+    return make_translated_member_names(std::move(original_mn),rep.get_translator(loc));
 }
 
 /**
@@ -241,7 +244,7 @@ inline auto make_translated_member_names(translator_cref translator)
  */
 inline auto make_translated_member_names(const translator_repository& rep, const std::string& loc=std::locale().name())
 {
-    return make_translated_member_names(*rep.find_translator(loc));
+    return make_translated_member_names(rep.get_translator(loc));
 }
 
 /**
@@ -277,6 +280,41 @@ auto make_decorated_member_names(OriginalMemberNamesT&& original_mn, DecoratorT&
             );
 }
 
+/**
+ * @brief Traits for member names formatter that caches formatted names of nested members.
+ */
+template <typename TraitsT>
+struct cached_member_names_traits_t : public TraitsT
+{
+    cached_member_names_traits_t(
+                TraitsT&& traits,
+                size_t max_size
+            ) : TraitsT(std::move(traits)),
+                names_cache(std::make_shared<member_names_cache>(max_size))
+    {}
+
+    std::shared_ptr<member_names_cache> names_cache;
+};
+
+/**
+ * @brief Make member names formatter that caches names formatted by other member names formatter.
+ * @param original_mn Original member names formatter.
+ * @param max_size Maximum number of cached names.
+ * @return Member names formatter that first looks up the cache and uses original formatter only for names that are not cached yet.
+ *
+ * The cache is shared by copies of the formatter.
+ */
+template <typename OriginalMemberNamesT>
+auto make_cached_member_names(OriginalMemberNamesT&& original_mn, size_t max_size=member_names_cache::default_max_size)
+{
+    return make_member_names(
+                cached_member_names_traits_t<typename std::decay_t<OriginalMemberNamesT>::traits_type>(
+                    std::move(original_mn.traits),
+                    max_size
+                )
+            );
+}
+
 /**
  * @brief Traits to format nested members as dot separated names decorated with brackets.
  *
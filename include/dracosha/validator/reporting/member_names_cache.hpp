@@ -0,0 +1,168 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/member_names_cache.hpp
+*
+* Defines cache of formatted member names.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_MEMBER_NAMES_CACHE_HPP
+#define DRACOSHA_VALIDATOR_MEMBER_NAMES_CACHE_HPP
+
+#include <string>
+#include <mutex>
+#include <typeindex>
+#include <functional>
+#include <unordered_map>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/property.hpp>
+#include <dracosha/validator/utils/to_string.hpp>
+#include <dracosha/validator/detail/member_path_key.hpp>
+#include <dracosha/validator/reporting/concrete_phrase.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Cache of formatted member names.
+ *
+ * Names are cached by type of member, runtime keys of member path and grammatical categories used for formatting.
+ * Names of members whose path contains keys other than strings, integers, properties and element aggregations are not cached.
+ *
+ * Cache is bounded by the maximum number of names, when the limit is reached the cache is cleared.
+ * Cache is thread safe and can be used by the same formatter in concurrent validations.
+ *
+ * Cached names are not invalidated automatically, so clear() must be called if translator used for member names is modified.
+ */
+class member_names_cache
+{
+    public:
+
+        /**
+         * @brief Default maximum number of cached names.
+         */
+        constexpr static const size_t default_max_size=1024;
+
+        /**
+         * @brief Constructor.
+         * @param max_size Maximum number of cached names, if 0 then names are not cached.
+         */
+        explicit member_names_cache(size_t max_size=default_max_size)
+            : _max_size(max_size)
+        {}
+
+        /**
+         * @brief Get cached name of member or format and cache it.
+         * @param member Member.
+         * @param grammar_cats Grammatical categories used for formatting.
+         * @param format Handler to format the name if it is not cached.
+         * @return Formatted name of member.
+         */
+        template <typename T, typename FormatT>
+        concrete_phrase name(const T& member, grammar_categories grammar_cats, FormatT&& format) const
+        {
+            if (_max_size==0)
+            {
+                return format();
+            }
+
+            key_type key{std::type_index(typeid(T)),std::string(),grammar_cats};
+            if (!detail::member_path_key(key.keys,member.path()))
+            {
+                return format();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it=_names.find(key);
+                if (it!=_names.end())
+                {
+                    return it->second;
+                }
+            }
+
+            concrete_phrase name=format();
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_names.size()>=_max_size)
+            {
+                _names.clear();
+            }
+            _names.emplace(std::move(key),name);
+            return name;
+        }
+
+        /**
+         * @brief Get number of cached names.
+         * @return Number of names.
+         */
+        size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _names.size();
+        }
+
+        /**
+         * @brief Get maximum number of cached names.
+         * @return Maximum number of names.
+         */
+        size_t max_size() const noexcept
+        {
+            return _max_size;
+        }
+
+        /**
+         * @brief Clear cache.
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _names.clear();
+        }
+
+    private:
+
+        struct key_type
+        {
+            std::type_index type;
+            std::string keys;
+            grammar_categories grammar_cats;
+
+            bool operator== (const key_type& other) const noexcept
+            {
+                return type==other.type && grammar_cats==other.grammar_cats && keys==other.keys;
+            }
+        };
+
+        struct key_hash
+        {
+            size_t operator() (const key_type& key) const noexcept
+            {
+                auto h=std::hash<std::type_index>{}(key.type);
+                h^=std::hash<std::string>{}(key.keys)+0x9e3779b9+(h<<6)+(h>>2);
+                h^=std::hash<grammar_categories>{}(key.grammar_cats)+0x9e3779b9+(h<<6)+(h>>2);
+                return h;
+            }
+        };
+
+        size_t _max_size;
+        mutable std::mutex _mutex;
+        mutable std::unordered_map<key_type,concrete_phrase,key_hash> _names;
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_MEMBER_NAMES_CACHE_HPP
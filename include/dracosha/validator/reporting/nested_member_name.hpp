@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/reporting/phrase_grammar_cats.hpp>
 #include <dracosha/validator/reporting/single_member_name.hpp>
 #include <dracosha/validator/reporting/backend_formatter.hpp>
+#include <dracosha/validator/reporting/member_names_cache.hpp>
 #include <dracosha/validator/variadic_property.hpp>
 #include <dracosha/validator/member_with_name.hpp>
 #include <dracosha/validator/member_with_name_list.hpp>
@@ -75,6 +76,28 @@ struct has_nested<T,TraitsT,
     constexpr static const bool value=true;
 };
 
+/**
+ * @brief Check if traits do not have cache of member names.
+ */
+template <typename TraitsT, typename =void>
+struct has_member_names_cache
+{
+    constexpr static const bool value=false;
+};
+
+/**
+ * @brief Check if traits have cache of member names.
+ */
+template <typename TraitsT>
+struct has_member_names_cache<TraitsT,
+                  decltype(
+                    (void)std::declval<const TraitsT&>().names_cache->size()
+                  )
+        >
+{
+    constexpr static const bool value=true;
+};
+
 /**
  * @brief Construct member path for member name formating in case of direct order of levels in the path.
  * @param path Original member path.
@@ -320,7 +343,29 @@ struct nested_member_name_t
 {
     auto operator() (const T& id, const TraitsT& traits, grammar_categories grammar_cats) const
     {
-        return detail::join_member_names(id,traits,grammar_cats);
+        return hana::eval_if(
+            hana::bool_c<
+                detail::has_member_names_cache<TraitsT>::value
+                &&
+                !std::is_base_of<member_with_name_list_tag,T>::value
+                &&
+                !T::is_with_varg::value
+            >,
+            [&](auto&& _)
+            {
+                // names of members with explicit names and variadic properties are not cached because they depend on more than the keys
+                return _(traits).names_cache->name(_(id),grammar_cats,
+                    [&]()
+                    {
+                        return detail::join_member_names(id,traits,grammar_cats);
+                    }
+                );
+            },
+            [&](auto&&)
+            {
+                return detail::join_member_names(id,traits,grammar_cats);
+            }
+        );
     }
 };
 
@@ -163,7 +163,7 @@ inline auto make_translated_operand_formatter(const translator_repository& rep,c
                                    const TranslateAllStringsT& translate_operands=std::false_type()
                                    )
 {
-    return make_translated_operand_formatter(*rep.find_translator(loc),std::forward<DecoratorT>(decorator),translate_operands);
+    return make_translated_operand_formatter(rep.get_translator(loc),std::forward<DecoratorT>(decorator),translate_operands);
 }
 
 //-------------------------------------------------------------
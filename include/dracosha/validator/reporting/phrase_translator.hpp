@@ -166,6 +166,15 @@ class phrase_translator : public translator
             return _phrases.empty();
         }
 
+        /**
+         * @brief Get translated phrases.
+         * @return Map of translated phrases.
+         */
+        const container_type& phrases() const noexcept
+        {
+            return _phrases;
+        }
+
     private:
 
         container_type _phrases;
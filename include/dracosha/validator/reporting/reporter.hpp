@@ -20,10 +20,14 @@ Distributed under the Boost Software License, Version 1.0.
 #define DRACOSHA_VALIDATOR_REPORTER_HPP
 
 #include <vector>
+#include <string>
 
 #include <dracosha/validator/config.hpp>
+#include <dracosha/validator/make_member.hpp>
+#include <dracosha/validator/aggregation/and.hpp>
 #include <dracosha/validator/reporting/report_aggregation.hpp>
 #include <dracosha/validator/reporting/formatter.hpp>
+#include <dracosha/validator/reporting/reporter_state.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -31,6 +35,54 @@ DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 struct reporter_tag;
 
+namespace detail
+{
+
+/**
+ * @brief Item of stack of aggregations of reporter that refers to the member whose name is not formatted yet.
+ */
+template <typename DstT, typename FormatterT>
+struct reporter_stack_item : public report_aggregation<DstT>
+{
+    using report_aggregation<DstT>::report_aggregation;
+    using member_formatter_fn=std::string (*)(const FormatterT&, const void*);
+
+    aggregation_id level_id() const noexcept
+    {
+        return this->aggregation.id;
+    }
+
+    size_t level_parts() const noexcept
+    {
+        return this->parts.size();
+    }
+
+    void list_parts()
+    {
+        this->aggregation=string_and;
+    }
+
+    void set_member(const void* member, member_formatter_fn fn) noexcept
+    {
+        member_ref=member;
+        member_formatter=fn;
+    }
+
+    void format_member(const FormatterT& formatter)
+    {
+        if (member_formatter!=nullptr)
+        {
+            this->member=member_formatter(formatter,member_ref);
+            member_formatter=nullptr;
+        }
+    }
+
+    const void* member_ref=nullptr;
+    member_formatter_fn member_formatter=nullptr;
+};
+
+}
+
 /**
  * @brief Reporter constructs a report regarding the failure.
  *
@@ -41,7 +93,7 @@ struct reporter_tag;
  * Actual formatting is performed by the formatter object.
  */
 template <typename DstT, typename FormatterT>
-class reporter
+class reporter : public reporter_state<detail::reporter_stack_item<typename DstT::type,std::decay_t<FormatterT>>>
 {
     public:
 
@@ -56,9 +108,7 @@ class reporter
                     DstT dst,
                     FormatterT&& formatter
                 ) : _dst(std::move(dst)),
-                    _formatter(std::forward<FormatterT>(formatter)),
-                    _not_count(0),
-                    _explicit_reporting_count(0)
+                    _formatter(std::forward<FormatterT>(formatter))
         {}
 
         /**
@@ -68,72 +118,88 @@ class reporter
         template <typename AggregationT>
         void aggregate_open(AggregationT&& aggregation)
         {
-            if (skip_aggregate_open() || skip_explicit_report())
+            if (this->skip_open())
             {
                 return;
             }
-            if (aggregation.id==aggregation_id::NOT)
-            {
-                ++_not_count;
-            }
-            _stack.emplace_back(std::forward<AggregationT>(aggregation));
+            open(std::forward<AggregationT>(aggregation));
         }
 
         /**
          * @brief Open validation step for aggregation operator with member.
          * @param aggregation Descriptor of aggregation operator.
          * @param member Member the validation operation is performed for.
+         *
+         * Name of the member is formatted only if the aggregation is reported, so if the member is passed by lvalue reference
+         * then it must stay valid until aggregate_close(). Temporary members are formatted immediately.
          */
         template <typename AggregationT, typename MemberT>
         void aggregate_open(AggregationT&& aggregation, MemberT&& member)
         {
-            if (skip_aggregate_open() || skip_explicit_report())
+            if (this->skip_open())
             {
                 return;
             }
-            if (aggregation.id==aggregation_id::NOT)
-            {
-                ++_not_count;
-            }
-            _stack.emplace_back(std::forward<AggregationT>(aggregation),
-                                _formatter.member_to_string(std::forward<MemberT>(member)));
+            open(std::forward<AggregationT>(aggregation));
+            hana::eval_if(
+                std::is_lvalue_reference<MemberT>{},
+                [&](auto&& _)
+                {
+                    _stack.back().set_member(&_(member),&format_member<std::decay_t<MemberT>>);
+                },
+                [&](auto&& _)
+                {
+                    _stack.back().member=_formatter.member_to_string(_(member));
+                }
+            );
         }
 
         /**
-         * @brief Close validation step for aggregation operator.
-         * @param ok Validation status of the aggregation operator.
+         * @brief Open validation step for aggregation operator with member given by path.
+         * @param aggregation Descriptor of aggregation operator.
+         * @param path Path of the member the validation operation is performed for, must stay valid until aggregate_close().
+         *
+         * The member is constructed and its name is formatted only if the aggregation is reported.
          */
-        void aggregate_close(bool ok)
+        template <typename AggregationT, typename PathT>
+        void aggregate_open_path(AggregationT&& aggregation, const PathT& path)
         {
-            if (skip_explicit_report())
+            if (this->skip_open())
             {
                 return;
             }
+            open(std::forward<AggregationT>(aggregation));
+            _stack.back().set_member(&path,&format_member_path<PathT>);
+        }
 
-            if (!_stack.empty())
-            {
-                auto& back=_stack.back();
-                if (skip_part())
-                {
-                    --back.any_all_count;
-                    if (back.any_all_count!=0)
-                    {
-                        return;
-                    }
-                }
+        /**
+         * @brief Report each failed element of current ALL aggregation instead of the first one.
+         *
+         * Used in collect-all-failures mode, the aggregation is reported as AND aggregation of failed elements.
+         */
+        void list_parts()
+        {
+            this->list_level();
+        }
 
-                if (!ok || current_not())
+        /**
+         * @brief Close validation step for aggregation operator.
+         * @param ok Validation status of the aggregation operator.
+         */
+        void aggregate_close(bool ok)
+        {
+            this->pop_level(
+                ok,
+                [this](stack_item& back)
                 {
                     updateBrackets();
+                    back.format_member(_formatter);
                     auto wrapper=wrap_backend_formatter(report_dst(),_dst);
-                    _formatter.aggregate(wrapper,back);
-                }
-                if (back.aggregation.id==aggregation_id::NOT)
-                {
-                    --_not_count;
-                }
-                _stack.pop_back();
-            }
+                    _formatter.aggregate(wrapper,static_cast<const aggregation_item&>(back));
+                },
+                [](stack_item&)
+                {}
+            );
         }
 
         /**
@@ -144,7 +210,7 @@ class reporter
         template <typename T2, typename OpT>
         void validate_operator(const OpT& op, const T2& b)
         {
-            if (skip_part() || skip_explicit_report())
+            if (this->skip_check())
             {
                 return;
             }
@@ -161,7 +227,7 @@ class reporter
         template <typename T2, typename OpT, typename PropT>
         void validate_property(const PropT& prop, const OpT& op, const T2& b)
         {
-            if (skip_part() || skip_explicit_report())
+            if (this->skip_check())
             {
                 return;
             }
@@ -177,7 +243,7 @@ class reporter
         template <typename T2, typename OpT, typename MemberT>
         void validate_exists(const MemberT& member, const OpT& op, const T2& b)
         {
-            if (skip_part() || skip_explicit_report())
+            if (this->skip_check())
             {
                 return;
             }
@@ -195,7 +261,7 @@ class reporter
         template <typename T2, typename OpT, typename PropT, typename MemberT>
         void validate(const MemberT& member, const PropT& prop, const OpT& op, const T2& b)
         {
-            if (skip_part() || skip_explicit_report())
+            if (this->skip_check())
             {
                 return;
             }
@@ -213,7 +279,7 @@ class reporter
         template <typename T2, typename OpT, typename PropT, typename MemberT>
         void validate_with_other_member(const MemberT& member, const PropT& prop, const OpT& op, const T2& b)
         {
-            if (skip_part() || skip_explicit_report())
+            if (this->skip_check())
             {
                 return;
             }
@@ -232,7 +298,7 @@ class reporter
         template <typename T2, typename OpT, typename PropT, typename MemberT, typename MemberSampleT>
         void validate_with_master_sample(const MemberT& member, const PropT& prop, const OpT& op, const MemberSampleT& member_sample, const T2& b)
         {
-            if (skip_part() || skip_explicit_report())
+            if (this->skip_check())
             {
                 return;
             }
@@ -250,35 +316,13 @@ class reporter
             return _dst;
         }
 
-        /**
-         * @brief Check if current validation step is within NOT operator.
-         * @return True if NOT aggregation operator is opened at any parent level.
-         */
-        bool current_not() const
-        {
-            return _not_count!=0;
-        }
-
-        /**
-         * @brief Begin report that uses reporting hint and ignores reportings from all next levels.
-         */
-        void begin_explicit_report()
-        {
-            ++_explicit_reporting_count;
-        }
-
         /**
          * @brief End report that uses reporting hint and ignores reportings from all next levels.
          * @param description Reporting hint that overrides report of the current level.
          */
         void end_explicit_report(const std::string& description)
         {
-            --_explicit_reporting_count;
-            if (skip_part())
-            {
-                return;
-            }
-            if (_explicit_reporting_count==0)
+            if (this->end_explicit_report_level())
             {
                 auto wrapper=wrap_backend_formatter(current(),_dst);
                 wrapper.append(description);
@@ -287,35 +331,29 @@ class reporter
 
     private:
 
-        bool skip_explicit_report() const noexcept
+        using formatter_type=std::decay_t<FormatterT>;
+        using aggregation_item=report_aggregation<typename DstT::type>;
+
+        using stack_item=detail::reporter_stack_item<typename DstT::type,formatter_type>;
+        using base_type=reporter_state<stack_item>;
+        using base_type::_stack;
+
+        template <typename MemberT>
+        static std::string format_member(const formatter_type& formatter, const void* member)
         {
-            return _explicit_reporting_count!=0;
+            return formatter.member_to_string(*static_cast<const MemberT*>(member));
         }
 
-        bool skip_part() const noexcept
+        template <typename PathT>
+        static std::string format_member_path(const formatter_type& formatter, const void* path)
         {
-            if (!_stack.empty())
-            {
-                const auto& back=_stack.back();
-                if (back.aggregation.id==aggregation_id::ANY
-                        ||
-                    back.aggregation.id==aggregation_id::ALL
-                    )
-                {
-                    return !back.parts.empty();
-                }
-            }
-            return false;
+            return formatter.member_to_string(make_member(*static_cast<const PathT*>(path)));
         }
 
-        bool skip_aggregate_open()
+        template <typename AggregationT>
+        void open(AggregationT&& aggregation)
         {
-            if (skip_part())
-            {
-                ++_stack.back().any_all_count;
-                return true;
-            }
-            return false;
+            this->push_level(stack_item(std::forward<AggregationT>(aggregation)));
         }
 
         typename DstT::type& current()
@@ -358,9 +396,6 @@ class reporter
 
         DstT _dst;
         FormatterT _formatter;
-        std::vector<report_aggregation<typename DstT::type>> _stack;
-        size_t _not_count;
-        size_t _explicit_reporting_count;
 };
 
 /**
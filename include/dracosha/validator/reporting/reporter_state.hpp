@@ -0,0 +1,243 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/reporter_state.hpp
+*
+*  Defines base class of reporters that decides which validation steps contribute to report.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_REPORTER_STATE_HPP
+#define DRACOSHA_VALIDATOR_REPORTER_STATE_HPP
+
+#include <vector>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/aggregation/aggregation.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Base class of reporters that keeps stack of aggregations and decides which validation steps contribute to report.
+ *
+ * Only the first failed element of ANY/ALL aggregation is reported, successful aggregations are not reported unless they are within NOT aggregation,
+ * reports of nested levels are ignored when explicit report with hint is used, and nothing is reported while reporting is suspended.
+ *
+ * Level of the stack must have methods level_id() and level_parts() returning ID of aggregation operator and number of reported parts respectively,
+ * method list_parts() that makes the level to be reported as AND aggregation,
+ * as well as any_all_count member used to count nested aggregations skipped within ANY/ALL aggregation.
+ */
+template <typename LevelT>
+class reporter_state
+{
+    public:
+
+        /**
+         * @brief Check if current validation step is within NOT operator.
+         * @return True if NOT aggregation operator is opened at any parent level.
+         */
+        bool current_not() const
+        {
+            return _not_count!=0;
+        }
+
+        /**
+         * @brief Begin report that uses reporting hint and ignores reportings from all next levels.
+         */
+        void begin_explicit_report()
+        {
+            ++_explicit_reporting_count;
+        }
+
+        /**
+         * @brief Suspend reporting, e.g. when budget of failures is exhausted in collect-all-failures mode.
+         *
+         * Suspensions can be nested, reporting is resumed when each suspend() is paired with resume().
+         */
+        void suspend() noexcept
+        {
+            ++_suspended_count;
+        }
+
+        /**
+         * @brief Resume reporting suspended with suspend().
+         */
+        void resume() noexcept
+        {
+            --_suspended_count;
+        }
+
+        /**
+         * @brief Check if reporting is suspended.
+         * @return Result of checking.
+         */
+        bool is_suspended() const noexcept
+        {
+            return _suspended_count!=0;
+        }
+
+    protected:
+
+        reporter_state()
+            : _not_count(0),
+              _explicit_reporting_count(0),
+              _suspended_count(0)
+        {}
+
+        /**
+         * @brief Check if opening of aggregation must be skipped.
+         * @return Result of checking.
+         */
+        bool skip_open()
+        {
+            return is_suspended() || skip_aggregate_open() || skip_explicit_report();
+        }
+
+        /**
+         * @brief Check if report of a check must be skipped.
+         * @return Result of checking.
+         */
+        bool skip_check() const noexcept
+        {
+            return is_suspended() || skip_part() || skip_explicit_report();
+        }
+
+        /**
+         * @brief Push level of aggregation to the stack.
+         * @param level Level.
+         */
+        void push_level(LevelT level)
+        {
+            if (level.level_id()==aggregation_id::NOT)
+            {
+                ++_not_count;
+            }
+            _stack.push_back(std::move(level));
+        }
+
+        /**
+         * @brief Pop level of aggregation from the stack when aggregation is closed.
+         * @param ok Validation status of the aggregation.
+         * @param report Handler invoked with the level if the aggregation must be reported.
+         * @param discard Handler invoked with the level if the aggregation must not be reported.
+         */
+        template <typename ReportT, typename DiscardT>
+        void pop_level(bool ok, ReportT&& report, DiscardT&& discard)
+        {
+            if (is_suspended() || skip_explicit_report() || _stack.empty())
+            {
+                return;
+            }
+
+            auto& back=_stack.back();
+            if (skip_part())
+            {
+                --back.any_all_count;
+                if (back.any_all_count!=0)
+                {
+                    return;
+                }
+            }
+
+            if (!ok || current_not())
+            {
+                report(back);
+            }
+            else
+            {
+                discard(back);
+            }
+            if (back.level_id()==aggregation_id::NOT)
+            {
+                --_not_count;
+            }
+            _stack.pop_back();
+        }
+
+        /**
+         * @brief Make current ALL aggregation to report all its parts instead of the first one.
+         * @return True if the current level was changed.
+         *
+         * Used in collect-all-failures mode, the aggregation is reported as AND aggregation of its failed elements.
+         */
+        bool list_level()
+        {
+            if (is_suspended() || skip_explicit_report() || _stack.empty())
+            {
+                return false;
+            }
+            auto& back=_stack.back();
+            if (back.level_id()!=aggregation_id::ALL)
+            {
+                return false;
+            }
+            back.list_parts();
+            return true;
+        }
+
+        /**
+         * @brief End explicit report.
+         * @return True if hint of explicit report must be reported.
+         */
+        bool end_explicit_report_level()
+        {
+            --_explicit_reporting_count;
+            return !is_suspended() && !skip_part() && _explicit_reporting_count==0;
+        }
+
+        std::vector<LevelT> _stack;
+
+    private:
+
+        bool skip_explicit_report() const noexcept
+        {
+            return _explicit_reporting_count!=0;
+        }
+
+        bool skip_part() const noexcept
+        {
+            if (!_stack.empty())
+            {
+                const auto& back=_stack.back();
+                if (back.level_id()==aggregation_id::ANY
+                        ||
+                    back.level_id()==aggregation_id::ALL
+                    )
+                {
+                    return back.level_parts()!=0;
+                }
+            }
+            return false;
+        }
+
+        bool skip_aggregate_open()
+        {
+            if (skip_part())
+            {
+                ++_stack.back().any_all_count;
+                return true;
+            }
+            return false;
+        }
+
+        size_t _not_count;
+        size_t _explicit_reporting_count;
+        size_t _suspended_count;
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_REPORTER_STATE_HPP
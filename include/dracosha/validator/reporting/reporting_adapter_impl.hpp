@@ -212,6 +212,33 @@ class reporting_adapter_impl : public reporting_adapter_tag
             return _reporter;
         }
 
+        /**
+         * @brief Suspend reports, e.g. when budget of failures is exhausted in collect-all-failures mode.
+         */
+        template <typename T=ReporterT>
+        auto suspend_reports() -> decltype(std::declval<T&>().suspend())
+        {
+            _reporter.suspend();
+        }
+
+        /**
+         * @brief Resume reports suspended with suspend_reports().
+         */
+        template <typename T=ReporterT>
+        auto resume_reports() -> decltype(std::declval<T&>().resume())
+        {
+            _reporter.resume();
+        }
+
+        /**
+         * @brief Report each failed element of current ALL aggregation, used in collect-all-failures mode.
+         */
+        template <typename T=ReporterT>
+        auto list_reports() -> decltype(std::declval<T&>().list_parts())
+        {
+            _reporter.list_parts();
+        }
+
     private:
 
         template <typename AgrregationT,typename HandlerT, typename ...Args>
@@ -199,7 +199,7 @@ struct make_translated_strings_t
      */
     auto operator() (const translator_repository& rep,const std::string& loc=std::locale().name()) const
     {
-        return translated_strings<const aggregation_strings_t&>{*rep.find_translator(loc),aggregation_strings};
+        return translated_strings<const aggregation_strings_t&>{rep.get_translator(loc),aggregation_strings};
     }
 
     /**
@@ -212,7 +212,7 @@ struct make_translated_strings_t
     template <typename T>
     auto operator() (T&& aggregation_str,const translator_repository& rep,const std::string& loc=std::locale().name()) const
     {
-        return translated_strings<T>{*rep.find_translator(loc),std::forward<T>(aggregation_str)};
+        return translated_strings<T>{rep.get_translator(loc),std::forward<T>(aggregation_str)};
     }
 };
 /**
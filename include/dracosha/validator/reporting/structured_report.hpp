@@ -0,0 +1,1089 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/structured_report.hpp
+*
+*  Defines structured error report whose text is formatted only when requested.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_STRUCTURED_REPORT_HPP
+#define DRACOSHA_VALIDATOR_STRUCTURED_REPORT_HPP
+
+#include <new>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+#include <typeinfo>
+#include <typeindex>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/error.hpp>
+#include <dracosha/validator/aggregation/and.hpp>
+#include <dracosha/validator/aggregation/or.hpp>
+#include <dracosha/validator/aggregation/not.hpp>
+#include <dracosha/validator/aggregation/any.hpp>
+#include <dracosha/validator/aggregation/all.hpp>
+#include <dracosha/validator/make_member.hpp>
+#include <dracosha/validator/member_with_name_list.hpp>
+#include <dracosha/validator/utils/wrap_object.hpp>
+#include <dracosha/validator/reporting/reporter.hpp>
+#include <dracosha/validator/reporting/reporter_state.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Kind of record in structured report.
+ */
+enum class report_record_kind : int
+{
+    aggregation_open, //!< Opening of aggregation operator.
+    aggregation_close, //!< Closing of failed aggregation operator.
+    object, //!< Check of object at one level without member nesting.
+    object_property, //!< Check of object's property at one level without member nesting.
+    member_exists, //!< Check of member existence.
+    member, //!< Check of member.
+    member_with_other_member, //!< Check of member using other member of the same object as operand.
+    member_with_master_sample, //!< Check of member using the same member of master sample object as operand.
+    hint //!< Explicit description that overrides reports of nested validators.
+};
+
+/**
+ * @brief Compact record of validation failure in structured report.
+ *
+ * Records keep only identifiers of what failed. Text of the records is formatted only when
+ * it is requested from the report.
+ */
+struct report_record
+{
+    /**
+     * @brief Constructor.
+     * @param kind Kind of record.
+     * @param depth Nesting level of aggregation operators.
+     * @param negated Flag that record is within NOT aggregation operator.
+     */
+    report_record(
+            report_record_kind kind,
+            size_t depth,
+            bool negated
+        ) : kind(kind),
+            aggregation(aggregation_id::AND),
+            depth(depth),
+            negated(negated),
+            operator_type(typeid(void)),
+            property_type(typeid(void)),
+            has_member(false)
+    {}
+
+    /**
+     * @brief Check if record describes a check but not aggregation operator.
+     * @return Flag.
+     */
+    bool is_check() const noexcept
+    {
+        return kind!=report_record_kind::aggregation_open
+                &&
+               kind!=report_record_kind::aggregation_close;
+    }
+
+    /**
+     * @brief Check if record describes a check with some operator.
+     * @param op Operator.
+     * @return Flag.
+     */
+    template <typename OpT>
+    bool is_operator(const OpT&) const noexcept
+    {
+        return operator_type==std::type_index(typeid(OpT));
+    }
+
+    /**
+     * @brief Check if record describes a check of some property.
+     * @param prop Property.
+     * @return Flag.
+     */
+    template <typename PropT>
+    bool is_property(const PropT&) const noexcept
+    {
+        return property_type==std::type_index(typeid(PropT));
+    }
+
+    report_record_kind kind;
+    aggregation_id aggregation; //!< Aggregation operator of aggregation records.
+    size_t depth;
+    bool negated;
+    std::type_index operator_type; //!< Type of operator or typeid(void) if not applicable.
+    std::type_index property_type; //!< Type of property or typeid(void) if not applicable.
+    bool has_member;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Get descriptor of aggregation operator by ID.
+ * @param id ID of aggregation operator.
+ * @return Descriptor of aggregation operator.
+ */
+inline aggregation_op aggregation_op_by_id(aggregation_id id)
+{
+    switch (id)
+    {
+        case aggregation_id::OR: return string_or;
+        case aggregation_id::NOT: return string_not;
+        case aggregation_id::ANY: return string_any;
+        case aggregation_id::ALL: return string_all;
+        default: break;
+    }
+    return string_and;
+}
+
+/**
+ * @brief Make member from path keeping types of keys of the path.
+ * @param path Member path.
+ * @return Member.
+ */
+template <typename PathT>
+auto make_member_of_path(const PathT& path)
+{
+    auto types=hana::transform(path,hana::typeid_);
+    auto member_tmpl=hana::unpack(hana::prepend(hana::drop_back(types),hana::back(types)),hana::template_<member>);
+    using member_type=typename decltype(member_tmpl)::type;
+    return member_type(hana::back(path),hana::drop_back(path));
+}
+
+/**
+ * @brief Copy member so that the copy does not refer to keys of the original member.
+ * @param member Member.
+ * @return Member with copies of keys and names of the original member.
+ *
+ * Paths of members used during validation can refer to keys owned by validator or by temporary members,
+ * so members are copied with their keys when they are put to structured report.
+ */
+template <typename MemberT>
+auto copy_report_member(const MemberT& member)
+{
+    auto copy=make_member_of_path(copy_path_keys(member.path()));
+    return hana::eval_if(
+        std::is_base_of<member_with_name_list_tag,MemberT>{},
+        [&](auto&& _)
+        {
+            return make_member_with_name_list(std::move(_(copy)),_(member).name());
+        },
+        [&](auto&&)
+        {
+            return hana::eval_if(
+                std::is_base_of<member_with_name_tag,MemberT>{},
+                [&](auto&& _)
+                {
+                    return make_member_with_name(std::move(_(copy)),_(member).name());
+                },
+                [&](auto&& _)
+                {
+                    return std::move(_(copy));
+                }
+            );
+        }
+    );
+}
+
+/**
+ * @brief Copy operand of check to be put to structured report.
+ * @param operand Operand.
+ * @return Copy of member made with copy_report_member() if operand is a member, otherwise copy of operand as is.
+ */
+template <typename T>
+auto copy_report_operand(const T& operand)
+{
+    return hana::eval_if(
+        hana::is_a<member_tag,T>,
+        [&](auto&& _)
+        {
+            return copy_report_member(_(operand));
+        },
+        [&](auto&& _)
+        {
+            return _(operand);
+        }
+    );
+}
+
+/**
+ * @brief Storage of operands of records of structured report.
+ *
+ * Operands of records are placed one after another in memory blocks owned by the storage,
+ * so that a record does not need a separate heap allocation. Operands are destroyed when the storage is cleared.
+ */
+class report_operands_storage
+{
+    public:
+
+        /**
+         * @brief Default size of memory block.
+         */
+        constexpr static const size_t block_size=1024;
+
+        report_operands_storage() : _offset(0), _capacity(0)
+        {}
+
+        ~report_operands_storage()
+        {
+            clear();
+        }
+
+        report_operands_storage(const report_operands_storage&)=delete;
+        report_operands_storage& operator= (const report_operands_storage&)=delete;
+
+        report_operands_storage(report_operands_storage&& other) noexcept
+            : _blocks(std::move(other._blocks)),
+              _destructors(std::move(other._destructors)),
+              _offset(other._offset),
+              _capacity(other._capacity)
+        {
+            other._blocks.clear();
+            other._destructors.clear();
+            other._offset=0;
+            other._capacity=0;
+        }
+
+        report_operands_storage& operator= (report_operands_storage&& other) noexcept
+        {
+            if (this!=&other)
+            {
+                clear();
+                _blocks=std::move(other._blocks);
+                _destructors=std::move(other._destructors);
+                _offset=other._offset;
+                _capacity=other._capacity;
+                other._blocks.clear();
+                other._destructors.clear();
+                other._offset=0;
+                other._capacity=0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Construct object in the storage.
+         * @param val Value to move or copy to the storage.
+         * @return Pointer to constructed object that is valid until the storage is cleared.
+         */
+        template <typename T>
+        const std::decay_t<T>* emplace(T&& val)
+        {
+            using type=std::decay_t<T>;
+            static_assert(alignof(type)<=alignof(std::max_align_t),"Unsupported alignment of operands of structured report");
+
+            _destructors.reserve(_destructors.size()+1);
+            auto* obj=new (allocate(sizeof(type),alignof(type))) type(std::forward<T>(val));
+            if (!std::is_trivially_destructible<type>::value)
+            {
+                _destructors.push_back(destructor{obj,&destroy<type>});
+            }
+            return obj;
+        }
+
+        /**
+         * @brief Destroy all objects in the storage.
+         *
+         * The first memory block is kept for reuse.
+         */
+        void clear() noexcept
+        {
+            for (auto it=_destructors.rbegin();it!=_destructors.rend();++it)
+            {
+                it->fn(it->obj);
+            }
+            _destructors.clear();
+            if (!_blocks.empty())
+            {
+                _blocks.erase(_blocks.begin()+1,_blocks.end());
+                _capacity=block_size;
+            }
+            _offset=0;
+        }
+
+    private:
+
+        struct destructor
+        {
+            void* obj;
+            void (*fn)(void*);
+        };
+
+        template <typename T>
+        static void destroy(void* obj) noexcept
+        {
+            static_cast<T*>(obj)->~T();
+        }
+
+        void* allocate(size_t size, size_t align)
+        {
+            size_t offset=(_offset+align-1)/align*align;
+            if (_blocks.empty() || offset+size>_capacity)
+            {
+                if (_blocks.empty() && size>block_size)
+                {
+                    // the first block always has default size so that it can be reused after clear()
+                    _blocks.emplace_back(new char[block_size]);
+                }
+                _capacity=std::max(size,size_t(block_size));
+                _blocks.emplace_back(new char[_capacity]);
+                offset=0;
+            }
+            _offset=offset+size;
+            return _blocks.back().get()+offset;
+        }
+
+        std::vector<std::unique_ptr<char[]>> _blocks;
+        std::vector<destructor> _destructors;
+        size_t _offset;
+        size_t _capacity;
+};
+
+/**
+ * @brief Operands of record of aggregation operator with member.
+ */
+template <typename MemberT>
+struct aggregation_report_operands
+{
+    MemberT member;
+
+    template <typename ReporterT>
+    void replay(const report_record& record, ReporterT& r) const
+    {
+        r.aggregate_open(aggregation_op_by_id(record.aggregation),member);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT& formatter) const
+    {
+        return formatter.member_to_string(member);
+    }
+};
+
+/**
+ * @brief Operands of record of check of object at one level without member nesting.
+ */
+template <typename OpT, typename T2>
+struct object_report_operands
+{
+    OpT op;
+    T2 b;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.validate_operator(op,b);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT&) const
+    {
+        return std::string();
+    }
+};
+
+/**
+ * @brief Operands of record of check of object's property at one level without member nesting.
+ */
+template <typename PropT, typename OpT, typename T2>
+struct object_property_report_operands
+{
+    PropT prop;
+    OpT op;
+    T2 b;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.validate_property(prop,op,b);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT&) const
+    {
+        return std::string();
+    }
+};
+
+/**
+ * @brief Operands of record of check of member existence.
+ */
+template <typename MemberT, typename OpT, typename T2>
+struct member_exists_report_operands
+{
+    MemberT member;
+    OpT op;
+    T2 b;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.validate_exists(member,op,b);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT& formatter) const
+    {
+        return formatter.member_to_string(member);
+    }
+};
+
+/**
+ * @brief Operands of record of check of member with a value.
+ */
+template <typename MemberT, typename PropT, typename OpT, typename T2>
+struct member_report_operands
+{
+    MemberT member;
+    PropT prop;
+    OpT op;
+    T2 b;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.validate(member,prop,op,b);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT& formatter) const
+    {
+        return formatter.member_to_string(member);
+    }
+};
+
+/**
+ * @brief Operands of record of check of member with other member of the same object.
+ */
+template <typename MemberT, typename PropT, typename OpT, typename T2>
+struct other_member_report_operands
+{
+    member_report_operands<MemberT,PropT,OpT,T2> operands;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.validate_with_other_member(operands.member,operands.prop,operands.op,operands.b);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT& formatter) const
+    {
+        return operands.member_name(formatter);
+    }
+};
+
+/**
+ * @brief Operands of record of check of member with the same member of master sample object.
+ */
+template <typename MemberT, typename PropT, typename OpT, typename MemberSampleT, typename T2>
+struct master_sample_report_operands
+{
+    MemberT member;
+    PropT prop;
+    OpT op;
+    MemberSampleT member_sample;
+    T2 b;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.validate_with_master_sample(member,prop,op,member_sample,b);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT& formatter) const
+    {
+        return formatter.member_to_string(member);
+    }
+};
+
+/**
+ * @brief Operands of record of explicit description.
+ */
+struct hint_report_operands
+{
+    std::string description;
+
+    template <typename ReporterT>
+    void replay(const report_record&, ReporterT& r) const
+    {
+        r.begin_explicit_report();
+        r.end_explicit_report(description);
+    }
+
+    template <typename FormatterT>
+    std::string member_name(const FormatterT&) const
+    {
+        return std::string();
+    }
+};
+
+}
+
+/**
+ * @brief Error status with structured description that is formatted only when requested.
+ *
+ * During validation the report is filled with compact records by structured_reporter. Records keep the kind of the check
+ * and operands of the check, i.e. members, properties, operators and sample values. Operands are copied to storage owned by the report,
+ * members are copied together with their keys, so the report does not refer to the validator. Text of the report is formatted
+ * with the formatter only when message() or member_name() is called. Thus, failures can be counted and routed
+ * by kinds, operators or properties without formatting of texts.
+ *
+ * Formatter, object under validation and objects referenced by operands, e.g. master sample objects, must stay valid until the text is formatted.
+ * Text of the report is the same as that constructed by reporting adapter with the same formatter.
+ */
+template <typename FormatterT>
+class basic_structured_error_report : public error
+{
+    public:
+
+        using formatter_type=FormatterT;
+        using replay_reporter_type=reporter<
+                decltype(wrap_backend_formatter(std::declval<std::string&>())),
+                const FormatterT&
+            >;
+
+        /**
+         * @brief Constructor with default formatter.
+         */
+        basic_structured_error_report() : basic_structured_error_report(get_default_formatter())
+        {}
+
+        /**
+         * @brief Constructor.
+         * @param formatter Formatter to use for text formatting.
+         */
+        explicit basic_structured_error_report(
+                const FormatterT& formatter
+            ) : _formatter(&formatter),
+                _rendered(false)
+        {}
+
+        /**
+         * @brief Get records of the report.
+         * @return Records in order of validation including records of aggregation operators.
+         */
+        const std::vector<report_record>& records() const noexcept
+        {
+            return _records;
+        }
+
+        /**
+         * @brief Get number of failed checks in the report.
+         * @return Number of records that are not records of aggregation operators.
+         */
+        size_t failure_count() const noexcept
+        {
+            size_t count=0;
+            for (auto&& record:_records)
+            {
+                if (record.is_check())
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Format name of the member the record refers to.
+         * @param index Index of the record.
+         * @return Formatted member name or empty string if record does not refer to a member.
+         */
+        std::string member_name(size_t index) const
+        {
+            std::string name;
+            const auto& record=_records.at(index);
+            if (record.has_member)
+            {
+                const auto& operands=_operands[index];
+                operands.replay(record,operands.ptr,*_formatter,nullptr,&name);
+            }
+            return name;
+        }
+
+        /**
+         * @brief Get desctiption of validation error.
+         * @return Description of validation error formatted on the first call.
+         */
+        std::string message() const
+        {
+            if (!_rendered)
+            {
+                auto r=replay_reporter_type(wrap_backend_formatter(_message),*_formatter);
+                for (size_t i=0;i<_records.size();i++)
+                {
+                    const auto& record=_records[i];
+                    const auto& operands=_operands[i];
+                    if (operands.ptr!=nullptr)
+                    {
+                        operands.replay(record,operands.ptr,*_formatter,&r,nullptr);
+                    }
+                    else if (record.kind==report_record_kind::aggregation_open)
+                    {
+                        r.aggregate_open(detail::aggregation_op_by_id(record.aggregation));
+                    }
+                    else if (record.kind==report_record_kind::aggregation_close)
+                    {
+                        // closing records are added only for aggregations that must be reported
+                        r.aggregate_close(false);
+                    }
+                }
+                _rendered=true;
+            }
+            return _message;
+        }
+
+        /**
+         * @brief Reset report.
+         */
+        void reset()
+        {
+            _records.clear();
+            _operands.clear();
+            _storage.clear();
+            _message.clear();
+            _rendered=false;
+            error::reset();
+        }
+
+        /**
+         * @brief Add record without operands to the report, e.g. record of aggregation operator without member.
+         * @param record Record.
+         */
+        void add_record(report_record record)
+        {
+            _records.push_back(std::move(record));
+            _operands.push_back(operands_ref{nullptr,nullptr});
+            _rendered=false;
+        }
+
+        /**
+         * @brief Add record with operands to the report.
+         * @param record Record.
+         * @param operands Operands of the record, see operand types in detail namespace.
+         */
+        template <typename OperandsT>
+        void add_record(report_record record, OperandsT&& operands)
+        {
+            using type=std::decay_t<OperandsT>;
+            _records.reserve(_records.size()+1);
+            _operands.reserve(_operands.size()+1);
+            const auto* ptr=_storage.emplace(std::forward<OperandsT>(operands));
+            _records.push_back(std::move(record));
+            _operands.push_back(operands_ref{ptr,&replay_operands<type>});
+            _rendered=false;
+        }
+
+        /**
+         * @brief Remove records starting from some index.
+         * @param index Index of the first record to remove.
+         *
+         * Operands of removed records are kept in the storage until the report is reset.
+         */
+        void truncate(size_t index)
+        {
+            _records.erase(_records.begin()+index,_records.end());
+            _operands.erase(_operands.begin()+index,_operands.end());
+        }
+
+        /**
+         * @brief Change aggregation operator of a record.
+         * @param index Index of the record.
+         * @param id ID of aggregation operator.
+         */
+        void set_aggregation(size_t index, aggregation_id id)
+        {
+            _records.at(index).aggregation=id;
+            _rendered=false;
+        }
+
+    private:
+
+        using replay_fn=void (*)(const report_record&, const void*, const FormatterT&, replay_reporter_type*, std::string*);
+
+        struct operands_ref
+        {
+            const void* ptr;
+            replay_fn replay;
+        };
+
+        /**
+         * @brief Replay record to reporter if reporter is not null, otherwise format member name of the record.
+         */
+        template <typename OperandsT>
+        static void replay_operands(const report_record& record, const void* ptr, const FormatterT& formatter, replay_reporter_type* r, std::string* name)
+        {
+            const auto& operands=*static_cast<const OperandsT*>(ptr);
+            if (r!=nullptr)
+            {
+                operands.replay(record,*r);
+            }
+            else
+            {
+                *name=operands.member_name(formatter);
+            }
+        }
+
+        const FormatterT* _formatter;
+        std::vector<report_record> _records;
+        std::vector<operands_ref> _operands;
+        detail::report_operands_storage _storage;
+
+        mutable std::string _message;
+        mutable bool _rendered;
+};
+
+/**
+ * @brief Structured error report with default formatter.
+ */
+using structured_error_report=basic_structured_error_report<
+        std::decay_t<decltype(get_default_formatter())>
+    >;
+
+namespace detail
+{
+
+/**
+ * @brief Level of stack of aggregations of structured reporter.
+ */
+struct structured_reporter_level
+{
+    aggregation_id id;
+    size_t index;
+    size_t parts;
+    size_t any_all_count;
+
+    aggregation_id level_id() const noexcept
+    {
+        return id;
+    }
+
+    size_t level_parts() const noexcept
+    {
+        return parts;
+    }
+
+    void list_parts() noexcept
+    {
+        id=aggregation_id::AND;
+    }
+};
+
+}
+
+/**
+ * @brief Reporter that fills structured error report.
+ *
+ * The reporter shares the logic of reporter by means of reporter_state and adds to structured report only those records
+ * that would contribute to the text report.
+ */
+template <typename FormatterT>
+class structured_reporter : public reporter_state<detail::structured_reporter_level>
+{
+    public:
+
+        using hana_tag=reporter_tag;
+        using report_type=basic_structured_error_report<FormatterT>;
+
+        /**
+         * @brief Constructor.
+         * @param report Structured report to fill.
+         */
+        explicit structured_reporter(
+                    report_type& report
+                ) : _report(report)
+        {}
+
+        /**
+         * @brief Open validation step for aggregation operator.
+         * @param aggregation Descriptor of aggregation operator.
+         */
+        template <typename AggregationT>
+        void aggregate_open(AggregationT&& aggregation)
+        {
+            if (skip_open())
+            {
+                return;
+            }
+            auto record=open(aggregation.id);
+            _report.add_record(std::move(record));
+        }
+
+        /**
+         * @brief Open validation step for aggregation operator with member.
+         * @param aggregation Descriptor of aggregation operator.
+         * @param member Member the validation operation is performed for.
+         */
+        template <typename AggregationT, typename MemberT>
+        void aggregate_open(AggregationT&& aggregation, MemberT&& member)
+        {
+            if (skip_open())
+            {
+                return;
+            }
+            auto record=open(aggregation.id);
+            record.has_member=true;
+            auto copy=detail::copy_report_member(member);
+            _report.add_record(std::move(record),detail::aggregation_report_operands<decltype(copy)>{std::move(copy)});
+        }
+
+        /**
+         * @brief Report each failed element of current ALL aggregation instead of the first one.
+         *
+         * Used in collect-all-failures mode, the aggregation is recorded as AND aggregation of failed elements.
+         */
+        void list_parts()
+        {
+            if (list_level())
+            {
+                _report.set_aggregation(_stack.back().index,aggregation_id::AND);
+            }
+        }
+
+        /**
+         * @brief Close validation step for aggregation operator.
+         * @param ok Validation status of the aggregation operator.
+         */
+        void aggregate_close(bool ok)
+        {
+            pop_level(
+                ok,
+                [this](level& back)
+                {
+                    auto record=_report.records()[back.index];
+                    record.kind=report_record_kind::aggregation_close;
+                    record.has_member=false;
+                    _report.add_record(std::move(record));
+                    add_part_to_parent();
+                },
+                [this](level& back)
+                {
+                    // successful aggregation does not contribute to report
+                    _report.truncate(back.index);
+                }
+            );
+        }
+
+        /**
+         *  @brief Report validation of object at one level without member nesting.
+         *  @param op Operator for validation.
+         *  @param b Sample argument for validation.
+         */
+        template <typename T2, typename OpT>
+        void validate_operator(const OpT& op, const T2& b)
+        {
+            if (skip_check())
+            {
+                return;
+            }
+            auto record=make_record(report_record_kind::object);
+            record.operator_type=typeid(OpT);
+            add(std::move(record),detail::object_report_operands<OpT,T2>{op,b});
+        }
+
+        /**
+         *  @brief Report validation of object's property at one level without member nesting.
+         *  @param prop Property to validate.
+         *  @param op Operator for validation.
+         *  @param b Sample argument for validation.
+         */
+        template <typename T2, typename OpT, typename PropT>
+        void validate_property(const PropT& prop, const OpT& op, const T2& b)
+        {
+            if (skip_check())
+            {
+                return;
+            }
+            auto record=make_record(report_record_kind::object_property);
+            record.operator_type=typeid(OpT);
+            record.property_type=typeid(PropT);
+            add(std::move(record),detail::object_property_report_operands<PropT,OpT,T2>{prop,op,b});
+        }
+
+        /**
+         *  @brief Report validation of existance of a member.
+         *  @param member Member descriptor.
+         *  @param op Operator for validation.
+         *  @param b Boolean flag, when true check if member exists, when false check if member does not exist.
+         */
+        template <typename T2, typename OpT, typename MemberT>
+        void validate_exists(const MemberT& member, const OpT& op, const T2& b)
+        {
+            if (skip_check())
+            {
+                return;
+            }
+            auto record=make_record(report_record_kind::member_exists);
+            record.operator_type=typeid(OpT);
+            record.has_member=true;
+            auto copy=detail::copy_report_member(member);
+            add(std::move(record),detail::member_exists_report_operands<decltype(copy),OpT,T2>{std::move(copy),op,b});
+        }
+
+        /**
+         *  @brief Report normal validation of a member.
+         *  @param member Member descriptor.
+         *  @param prop Property to validate.
+         *  @param op Operator for validation.
+         *  @param b Sample argument for validation.
+         */
+        template <typename T2, typename OpT, typename PropT, typename MemberT>
+        void validate(const MemberT& member, const PropT& prop, const OpT& op, const T2& b)
+        {
+            if (skip_check())
+            {
+                return;
+            }
+            add(make_member_record(report_record_kind::member,prop,op),make_member_operands(member,prop,op,b));
+        }
+
+        /**
+         *  @brief Report validation using other member of the same object as a reference argument for validation.
+         *  @param member Member descriptor.
+         *  @param prop Property to validate.
+         *  @param op Operator for validation.
+         *  @param b Descriptor of sample member of the same object.
+         */
+        template <typename T2, typename OpT, typename PropT, typename MemberT>
+        void validate_with_other_member(const MemberT& member, const PropT& prop, const OpT& op, const T2& b)
+        {
+            if (skip_check())
+            {
+                return;
+            }
+            auto operands=make_member_operands(member,prop,op,b);
+            add(make_member_record(report_record_kind::member_with_other_member,prop,op),
+                detail::other_member_report_operands<decltype(operands.member),PropT,OpT,decltype(operands.b)>{std::move(operands)}
+            );
+        }
+
+        /**
+         *  @brief Report validation using the same member of a Sample object.
+         *  @param member Member.
+         *  @param prop Property to validate.
+         *  @param op Operator for validation.
+         *  @param member_sample Member of sample object.
+         *  @param b Sample object whose member must be used as argument passed to validation operator.
+         */
+        template <typename T2, typename OpT, typename PropT, typename MemberT, typename MemberSampleT>
+        void validate_with_master_sample(const MemberT& member, const PropT& prop, const OpT& op, const MemberSampleT& member_sample, const T2& b)
+        {
+            if (skip_check())
+            {
+                return;
+            }
+            auto record=make_member_record(report_record_kind::member_with_master_sample,prop,op);
+            auto member_copy=detail::copy_report_member(member);
+            auto sample_copy=detail::copy_report_operand(member_sample);
+            add(std::move(record),
+                detail::master_sample_report_operands<decltype(member_copy),PropT,OpT,decltype(sample_copy),T2>{
+                    std::move(member_copy),prop,op,std::move(sample_copy),b
+                }
+            );
+        }
+
+        /**
+         * @brief End report that uses reporting hint and ignores reportings from all next levels.
+         * @param description Reporting hint that overrides report of the current level.
+         */
+        void end_explicit_report(const std::string& description)
+        {
+            if (end_explicit_report_level())
+            {
+                add(make_record(report_record_kind::hint),detail::hint_report_operands{description});
+            }
+        }
+
+    private:
+
+        using level=detail::structured_reporter_level;
+
+        report_record make_record(report_record_kind kind, aggregation_id id=aggregation_id::AND) const
+        {
+            report_record record(kind,_stack.size(),current_not());
+            record.aggregation=id;
+            return record;
+        }
+
+        report_record open(aggregation_id id)
+        {
+            auto record=make_record(report_record_kind::aggregation_open,id);
+            push_level(level{id,_report.records().size(),0,
+                             static_cast<size_t>(id==aggregation_id::ANY || id==aggregation_id::ALL)});
+            return record;
+        }
+
+        template <typename OperandsT>
+        void add(report_record record, OperandsT&& operands)
+        {
+            _report.add_record(std::move(record),std::forward<OperandsT>(operands));
+            if (!_stack.empty())
+            {
+                ++_stack.back().parts;
+            }
+        }
+
+        template <typename PropT, typename OpT>
+        report_record make_member_record(report_record_kind kind, const PropT&, const OpT&) const
+        {
+            auto record=make_record(kind);
+            record.operator_type=typeid(OpT);
+            record.property_type=typeid(PropT);
+            record.has_member=true;
+            return record;
+        }
+
+        template <typename MemberT, typename PropT, typename OpT, typename T2>
+        static auto make_member_operands(const MemberT& member, const PropT& prop, const OpT& op, const T2& b)
+        {
+            auto member_copy=detail::copy_report_member(member);
+            auto b_copy=detail::copy_report_operand(b);
+            return detail::member_report_operands<decltype(member_copy),PropT,OpT,decltype(b_copy)>{
+                    std::move(member_copy),prop,op,std::move(b_copy)
+                };
+        }
+
+        void add_part_to_parent()
+        {
+            if (_stack.size()>1)
+            {
+                ++_stack.at(_stack.size()-2).parts;
+            }
+        }
+
+        report_type& _report;
+};
+
+/**
+ * @brief Make a reporter that fills structured error report.
+ * @param report Structured error report.
+ * @return Reporter.
+ */
+template <typename FormatterT>
+auto make_structured_reporter(basic_structured_error_report<FormatterT>& report)
+{
+    return structured_reporter<FormatterT>(report);
+}
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_STRUCTURED_REPORT_HPP
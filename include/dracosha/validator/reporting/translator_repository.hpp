@@ -24,6 +24,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <set>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
 
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/reporting/translator.hpp>
@@ -52,6 +56,10 @@ DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
 \endcode
 
+ * Results of translator lookups are cached per name of locale, including lookups that fall back to the default translator.
+ * Lookups of cached names do not lock and can be performed concurrently.
+ * Repository must be filled before it is used for lookups, i.e. methods that modify the repository
+ * must not be called concurrently with lookups.
  */
 class translator_repository
 {
@@ -95,6 +103,38 @@ class translator_repository
             ) : _default_translator(std::make_shared<translator>())
         {}
 
+        /**
+         * @brief Copy constructor.
+         * @param other Other repository.
+         *
+         * Cached lookup results are not copied.
+         */
+        translator_repository(
+                const translator_repository& other
+            ) : _default_translator(other._default_translator),
+                _translators(other._translators)
+        {}
+
+        /**
+         * @brief Copy assignment operator.
+         * @param other Other repository.
+         * @return Reference to this repository.
+         *
+         * Cached lookup results are not copied.
+         */
+        translator_repository& operator= (const translator_repository& other)
+        {
+            if (this!=&other)
+            {
+                _default_translator=other._default_translator;
+                _translators=other._translators;
+                reset_cache();
+            }
+            return *this;
+        }
+
+        ~translator_repository()=default;
+
         /**
          * @brief Add translator to repository.
          * @param tr Translator.
@@ -109,6 +149,7 @@ class translator_repository
             {
                 _translators[it]=tr;
             }
+            reset_cache();
         }
 
         /**
@@ -119,21 +160,26 @@ class translator_repository
          * First, it tries to find the most specific name of the locale.
          * The the name is repeatedly truncated down to the name of language only.
          * If still no translator is found then the default translator is returned.
+         *
+         * Returned pointer stays valid even if the repository is modified later, so it can be kept
+         * and used instead of repeated lookups.
          */
-        std::shared_ptr<translator> find_translator(std::string loc=std::locale().name()) const
+        std::shared_ptr<translator> find_translator(const std::string& loc=std::locale().name()) const
         {
-            size_t i=0;
-            while(!loc.empty() && i<3)
-            {
-                auto it=_translators.find(loc);
-                if (it!=_translators.end())
-                {
-                    return it->second;
-                }
-                std::string delimiter=(i++==0)?".":"_";
-                loc=loc.substr(0,loc.find(delimiter));
-            }
-            return _default_translator;
+            return cached_translator(loc);
+        }
+
+        /**
+         * @brief Get translator for locale.
+         * @param loc Locale name.
+         * @return Reference to translator suitable of this locale.
+         *
+         * The same as find_translator() but without copying of shared pointer.
+         * Returned reference is valid until the repository is modified or destroyed.
+         */
+        const translator& get_translator(const std::string& loc=std::locale().name()) const
+        {
+            return *cached_translator(loc);
         }
 
         /**
@@ -143,6 +189,7 @@ class translator_repository
         void set_default_translator(std::shared_ptr<translator> default_translator) noexcept
         {
             _default_translator=std::move(default_translator);
+            reset_cache();
         }
 
         /**
@@ -160,12 +207,106 @@ class translator_repository
         void clear() noexcept
         {
             _translators.clear();
+            reset_cache();
+        }
+
+        /**
+         * @brief Get number of locale names with cached lookup results.
+         * @return Number of cached locale names.
+         */
+        size_t cached_locale_count() const noexcept
+        {
+            auto cache=_cache.load(std::memory_order_acquire);
+            return cache==nullptr ? 0 : cache->size();
         }
 
+        /**
+         * @brief Maximum number of locale names whose lookup results are cached.
+         *
+         * Lookups of other names are performed without caching.
+         */
+        constexpr static const size_t max_cached_locales=64;
+
     private:
 
+        using cache_type=std::unordered_map<std::string,std::shared_ptr<translator>>;
+
+        const std::shared_ptr<translator>& cached_translator(const std::string& loc) const
+        {
+            // lock-free path for names of locales that were already looked up
+            auto cache=_cache.load(std::memory_order_acquire);
+            if (cache!=nullptr)
+            {
+                auto it=cache->find(loc);
+                if (it!=cache->end())
+                {
+                    return it->second;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            cache=_cache.load(std::memory_order_acquire);
+            if (cache!=nullptr)
+            {
+                auto it=cache->find(loc);
+                if (it!=cache->end())
+                {
+                    // name was looked up concurrently in other thread
+                    return it->second;
+                }
+                if (cache->size()>=max_cached_locales)
+                {
+                    return lookup(loc);
+                }
+            }
+
+            // cache is immutable, so it is copied with new entry and published as a whole,
+            // previous versions are kept because concurrent readers can still use them
+            auto updated=cache==nullptr ? std::make_unique<cache_type>() : std::make_unique<cache_type>(*cache);
+            auto inserted=updated->emplace(loc,lookup(loc));
+            const auto& tr=inserted.first->second;
+            const cache_type* published=updated.get();
+            try
+            {
+                // keep the new version before it is published, so that readers never see a freed cache
+                _caches.push_back(std::move(updated));
+            }
+            catch (...)
+            {
+                return lookup(loc);
+            }
+            _cache.store(published,std::memory_order_release);
+            return tr;
+        }
+
+        const std::shared_ptr<translator>& lookup(std::string loc) const
+        {
+            size_t i=0;
+            while(!loc.empty() && i<3)
+            {
+                auto it=_translators.find(loc);
+                if (it!=_translators.end())
+                {
+                    return it->second;
+                }
+                std::string delimiter=(i++==0)?".":"_";
+                loc=loc.substr(0,loc.find(delimiter));
+            }
+            return _default_translator;
+        }
+
+        void reset_cache() noexcept
+        {
+            _cache.store(nullptr,std::memory_order_release);
+            _caches.clear();
+        }
+
         std::shared_ptr<translator> _default_translator;
         std::map<std::string,std::shared_ptr<translator>> _translators;
+
+        mutable std::mutex _mutex;
+        mutable std::atomic<const cache_type*> _cache{nullptr};
+        mutable std::vector<std::unique_ptr<const cache_type>> _caches;
 };
 
 //-------------------------------------------------------------
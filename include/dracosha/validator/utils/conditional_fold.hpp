@@ -30,28 +30,31 @@ namespace detail {
 
 /**
  * @brief Implementations of while_each() and while_prefix().
+ *
+ * Elements are accessed by index, so that the remaining elements are not copied into a new foldable on each step.
  */
-template <typename FoldableT>
+template <typename FoldableT, size_t Index=0>
 struct conditional_fold_t
 {
+    constexpr static const bool is_last=(Index+1)==decltype(hana::size(std::declval<const FoldableT&>()))::value;
+
     template <typename HandlerT, typename PredicateT>
     static auto each(const FoldableT& foldable, const PredicateT& pred, const HandlerT& fn)
     {
-        auto res=fn(hana::front(foldable));
+        auto res=fn(hana::at_c<Index>(foldable));
         if (!pred(res))
         {
             return res;
         }
-        auto next=hana::drop_front(foldable);
         return hana::eval_if(
-            hana::is_empty(next),
+            hana::bool_c<is_last>,
             [&](auto&&)
             {
                 return res;
             },
             [&](auto&& _)
             {
-                return conditional_fold_t<decltype(_(next))>::each(_(next),pred,fn);
+                return conditional_fold_t<FoldableT,Index+1>::each(_(foldable),pred,fn);
             }
         );
     }
@@ -59,21 +62,20 @@ struct conditional_fold_t
     template <typename PredicateT, typename StateT, typename HandlerT>
     static auto each_with_state(const FoldableT& foldable, const PredicateT& pred, StateT&& state, const HandlerT& fn)
     {
-        auto res=fn(state,hana::front(foldable));
+        auto res=fn(state,hana::at_c<Index>(foldable));
         if (!pred(res))
         {
             return res;
         }
-        auto next=hana::drop_front(foldable);
         return hana::eval_if(
-            hana::is_empty(next),
+            hana::bool_c<is_last>,
             [&](auto&& _)
             {
                 return _(res);
             },
             [&](auto&& _)
             {
-                return conditional_fold_t<decltype(_(next))>::each_with_state(_(next),pred,_(res),fn);
+                return conditional_fold_t<FoldableT,Index+1>::each_with_state(_(foldable),pred,_(res),fn);
             }
         );
     }
@@ -82,46 +84,43 @@ DCS_IGNORE_MAYBE_UNINITIALIZED_BEGIN
     template <typename PredicateT, typename StateT, typename RetT, typename HandlerT>
     static auto each_with_state_and_ret(const FoldableT& foldable, const PredicateT& pred, StateT&& state, RetT&& ret, const HandlerT& fn)
     {
-        auto res=fn(state,hana::front(foldable));
+        auto res=fn(state,hana::at_c<Index>(foldable));
         if (!pred(res))
         {
             return ret;
         }
-        auto next=hana::drop_front(foldable);
         return hana::eval_if(
-            hana::is_empty(next),
+            hana::bool_c<is_last>,
             [&](auto&& _)
             {
                 return _(res);
             },
             [&](auto&& _)
             {
-                return conditional_fold_t<decltype(_(next))>::each_with_state_and_ret(_(next),pred,_(res),_(ret),fn);
+                return conditional_fold_t<FoldableT,Index+1>::each_with_state_and_ret(_(foldable),pred,_(res),_(ret),fn);
             }
         );
     }
 DCS_IGNORE_MAYBE_UNINITIALIZED_END
 
-    template <typename PrefixT, typename NextT, typename StateT, typename HandlerT, typename PredicateT>
-    static auto prefix(PrefixT&& pfx, const NextT& foldable, const PredicateT& pred, StateT&& state, const HandlerT& fn)
+    template <typename PrefixT, typename StateT, typename HandlerT, typename PredicateT>
+    static auto prefix(PrefixT&& pfx, const FoldableT& foldable, const PredicateT& pred, StateT&& state, const HandlerT& fn)
     {
-        auto front=hana::front(foldable);
-        auto new_prefix=hana::append(std::forward<PrefixT>(pfx),front);
+        auto new_prefix=hana::append(std::forward<PrefixT>(pfx),hana::at_c<Index>(foldable));
         std::decay_t<StateT> res=fn(state,new_prefix);
         if (!pred(res))
         {
             return res;
         }
-        auto next=hana::drop_front(foldable);
         return hana::eval_if(
-            hana::is_empty(next),
+            hana::bool_c<is_last>,
             [&](auto&&)
             {
                 return res;
             },
             [&](auto&& _)
             {
-                return conditional_fold_t<decltype(_(next))>::prefix(std::move(_(new_prefix)),_(next),pred,res,fn);
+                return conditional_fold_t<FoldableT,Index+1>::prefix(std::move(_(new_prefix)),_(foldable),pred,res,fn);
             }
         );
     }
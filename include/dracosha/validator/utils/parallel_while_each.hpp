@@ -0,0 +1,173 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/utils/parallel_while_each.hpp
+*
+*  Defines helper to iterate over a range of indexes in a thread pool while predicate is satisfied.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_PARALLEL_WHILE_EACH_HPP
+#define DRACOSHA_VALIDATOR_PARALLEL_WHILE_EACH_HPP
+
+#include <atomic>
+#include <exception>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/thread_pool.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementer of parallel_while_each().
+ */
+struct parallel_while_each_impl
+{
+    /**
+     * @brief Invoke handler for each index in range [0,count) using worker threads of a thread pool.
+     * @param pool Thread pool.
+     * @param count Number of indexes.
+     * @param chunk_size Number of consecutive indexes processed by a worker at once.
+     * @param pred Predicate to check result of each invocation, iteration in all threads is cancelled when predicate is not satisfied.
+     * @param make_handler Factory of handlers, each chunk uses own handler created with make_handler().
+     * @param result Result that broke the iteration.
+     * @return True if iteration was broken, false if all indexes satisfied predicate.
+     *
+     * Calling thread participates in processing of chunks and waits until all chunks are done.
+     * Exception thrown by a handler cancels iteration and is re-thrown in the calling thread.
+     */
+    template <typename ResultT, typename PredicateT, typename HandlerFactoryT>
+    bool operator() (thread_pool& pool, size_t count, size_t chunk_size,
+                     const PredicateT& pred, const HandlerFactoryT& make_handler, ResultT& result) const
+    {
+        chunk_size=std::max(chunk_size,size_t(1));
+        size_t chunks=(count+chunk_size-1)/chunk_size;
+
+        std::atomic<size_t> next_chunk{0};
+        std::atomic<bool> stop{false};
+        std::mutex mutex;
+        std::condition_variable cond;
+        size_t running=0;
+        bool broken=false;
+        std::exception_ptr exception;
+
+        auto run=[&]()
+        {
+            try
+            {
+                auto handler=make_handler();
+                for (;;)
+                {
+                    size_t chunk=next_chunk.fetch_add(1);
+                    if (chunk>=chunks)
+                    {
+                        break;
+                    }
+                    size_t end=std::min(count,(chunk+1)*chunk_size);
+                    for (size_t i=chunk*chunk_size;i<end;i++)
+                    {
+                        if (stop.load(std::memory_order_relaxed))
+                        {
+                            return;
+                        }
+                        ResultT ret=handler(i);
+                        if (!pred(ret))
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (!broken && !exception)
+                            {
+                                broken=true;
+                                result=std::move(ret);
+                            }
+                            stop.store(true);
+                            return;
+                        }
+                    }
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!exception)
+                {
+                    exception=std::current_exception();
+                }
+                stop.store(true);
+            }
+        };
+
+        auto wait=[&]()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock,[&running](){return running==0;});
+        };
+
+        size_t workers=std::min(pool.size(),chunks>0?chunks-1:0);
+        try
+        {
+            for (size_t i=0;i<workers;i++)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++running;
+                }
+                try
+                {
+                    pool.post(
+                        [&]()
+                        {
+                            run();
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (--running==0)
+                            {
+                                cond.notify_all();
+                            }
+                        }
+                    );
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --running;
+                    throw;
+                }
+            }
+        }
+        catch (...)
+        {
+            // tasks that were already posted refer to local variables, so wait for them before leaving
+            stop.store(true);
+            wait();
+            throw;
+        }
+        run();
+
+        wait();
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+        return broken;
+    }
+};
+/**
+ * @brief Iterate over range of indexes in a thread pool while predicate is satisfied.
+ */
+constexpr parallel_while_each_impl parallel_while_each{};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_PARALLEL_WHILE_EACH_HPP
@@ -0,0 +1,277 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/utils/regex_cache.hpp
+*
+*  Defines cache of compiled regular expressions.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_REGEX_CACHE_HPP
+#define DRACOSHA_VALIDATOR_REGEX_CACHE_HPP
+
+#include <regex>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/string_view.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Thread safe bounded cache of compiled regular expressions keyed by pattern and syntax flags.
+ *
+ * When number of cached expressions reaches capacity then least recently used expression is evicted.
+ * Expressions are returned as shared pointers, so evicted expressions stay valid while they are in use.
+ *
+ * Lookups of cached expressions take only a shared lock, so threads finding expressions in cache do not block each other.
+ * Recency of use is tracked with atomic counters instead of reordering of entries, exclusive lock is taken only
+ * when an expression is added or evicted.
+ */
+class regex_cache
+{
+    public:
+
+        using flag_type=std::regex_constants::syntax_option_type;
+        using regex_ptr=std::shared_ptr<const std::regex>;
+
+        /**
+         * @brief Default maximum number of cached expressions.
+         */
+        constexpr static const size_t default_capacity=1024;
+
+        /**
+         * @brief Constructor.
+         * @param capacity Maximum number of cached expressions.
+         */
+        explicit regex_cache(size_t capacity=default_capacity) : _capacity(capacity)
+        {}
+
+        regex_cache(const regex_cache&)=delete;
+        regex_cache& operator= (const regex_cache&)=delete;
+
+        /**
+         * @brief Get process wide instance of regex cache used by regex operators.
+         * @return Regex cache.
+         */
+        static regex_cache& instance()
+        {
+            static regex_cache cache;
+            return cache;
+        }
+
+        /**
+         * @brief Get compiled expression for a pattern, compile it if expression is not in cache yet.
+         * @param pattern Pattern of regular expression.
+         * @param flags Syntax flags of regular expression.
+         * @return Compiled regular expression.
+         *
+         * @throws std::regex_error if pattern is invalid, invalid patterns are not cached.
+         */
+        regex_ptr get(string_view pattern, flag_type flags=std::regex_constants::ECMAScript)
+        {
+            auto hash=hash_of(pattern,flags);
+            {
+                std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+                auto found=find(hash,pattern,flags);
+                if (found!=_entries.end())
+                {
+                    ++_hits;
+                    touch(*found);
+                    return found->regex;
+                }
+            }
+
+            ++_misses;
+            auto rx=std::make_shared<const std::regex>(pattern.begin(),pattern.end(),flags);
+
+            std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+            if (_capacity==0)
+            {
+                return rx;
+            }
+            auto found=find(hash,pattern,flags);
+            if (found!=_entries.end())
+            {
+                // expression was compiled concurrently in other thread
+                touch(*found);
+                return found->regex;
+            }
+            while (_entries.size()>=_capacity)
+            {
+                evict();
+            }
+            _entries.emplace_front(hash,std::string(pattern.data(),pattern.size()),flags,rx);
+            touch(_entries.front());
+            _index.emplace(hash,_entries.begin());
+            return rx;
+        }
+
+        /**
+         * @brief Set maximum number of cached expressions.
+         * @param capacity Capacity, if zero then expressions are not cached.
+         */
+        void set_capacity(size_t capacity)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+            _capacity=capacity;
+            while (_entries.size()>_capacity)
+            {
+                evict();
+            }
+        }
+
+        /**
+         * @brief Get maximum number of cached expressions.
+         * @return Capacity.
+         */
+        size_t capacity() const
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+            return _capacity;
+        }
+
+        /**
+         * @brief Get number of cached expressions.
+         * @return Number of cached expressions.
+         */
+        size_t size() const
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+            return _entries.size();
+        }
+
+        /**
+         * @brief Remove all expressions from cache and reset counters.
+         */
+        void clear()
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+            _index.clear();
+            _entries.clear();
+            _hits=0;
+            _misses=0;
+        }
+
+        /**
+         * @brief Get number of lookups that found expression in cache.
+         * @return Number of hits.
+         */
+        size_t hits() const noexcept
+        {
+            return _hits.load();
+        }
+
+        /**
+         * @brief Get number of lookups that had to compile expression.
+         * @return Number of misses.
+         */
+        size_t misses() const noexcept
+        {
+            return _misses.load();
+        }
+
+    private:
+
+        struct entry
+        {
+            entry(size_t hash, std::string pattern, flag_type flags, regex_ptr regex)
+                : hash(hash),
+                  pattern(std::move(pattern)),
+                  flags(flags),
+                  regex(std::move(regex))
+            {}
+
+            size_t hash;
+            std::string pattern;
+            flag_type flags;
+            regex_ptr regex;
+            mutable std::atomic<uint64_t> last_used{0};
+        };
+        using list_type=std::list<entry>;
+
+        static size_t hash_of(string_view pattern, flag_type flags) noexcept
+        {
+            // FNV-1a
+            size_t hash=static_cast<size_t>(14695981039346656037ULL);
+            for (auto ch:pattern)
+            {
+                hash^=static_cast<unsigned char>(ch);
+                hash*=static_cast<size_t>(1099511628211ULL);
+            }
+            return hash^static_cast<size_t>(flags);
+        }
+
+        typename list_type::iterator find(size_t hash, string_view pattern, flag_type flags)
+        {
+            auto range=_index.equal_range(hash);
+            for (auto it=range.first;it!=range.second;++it)
+            {
+                const auto& e=*it->second;
+                if (e.flags==flags && string_view(e.pattern)==pattern)
+                {
+                    return it->second;
+                }
+            }
+            return _entries.end();
+        }
+
+        void touch(const entry& e) noexcept
+        {
+            e.last_used.store(++_tick,std::memory_order_relaxed);
+        }
+
+        void evict()
+        {
+            // eviction is rare comparing to lookups, so the least recently used entry is found with linear search
+            auto last=_entries.begin();
+            for (auto it=_entries.begin();it!=_entries.end();++it)
+            {
+                if (it->last_used.load(std::memory_order_relaxed)<last->last_used.load(std::memory_order_relaxed))
+                {
+                    last=it;
+                }
+            }
+            auto range=_index.equal_range(last->hash);
+            for (auto it=range.first;it!=range.second;++it)
+            {
+                if (it->second==last)
+                {
+                    _index.erase(it);
+                    break;
+                }
+            }
+            _entries.erase(last);
+        }
+
+        mutable std::shared_timed_mutex _mutex;
+        size_t _capacity;
+        list_type _entries;
+        std::unordered_multimap<size_t,typename list_type::iterator> _index;
+        std::atomic<size_t> _hits{0};
+        std::atomic<size_t> _misses{0};
+        std::atomic<uint64_t> _tick{0};
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_REGEX_CACHE_HPP
@@ -0,0 +1,171 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/utils/thread_pool.hpp
+*
+*  Defines simple pool of worker threads used for parallel validation.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_THREAD_POOL_HPP
+#define DRACOSHA_VALIDATOR_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+
+#include <dracosha/validator/config.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Pool of worker threads executing posted tasks in FIFO order.
+ *
+ * Tasks must not throw exceptions, callers are responsible for transferring exceptions to waiting threads.
+ * Pool is neither copyable nor movable, all worker threads are joined in destructor.
+ */
+class thread_pool
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param thread_count Number of worker threads, if zero then number of hardware threads is used.
+         */
+        explicit thread_pool(size_t thread_count=0)
+        {
+            if (thread_count==0)
+            {
+                thread_count=std::max(1u,std::thread::hardware_concurrency());
+            }
+            _workers.reserve(thread_count);
+            try
+            {
+                for (size_t i=0;i<thread_count;i++)
+                {
+                    _workers.emplace_back([this](){run();});
+                }
+            }
+            catch (...)
+            {
+                // threads that were already started must be joined before the vector is destroyed
+                stop();
+                throw;
+            }
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Waits for all queued tasks to be finished.
+         */
+        ~thread_pool()
+        {
+            stop();
+        }
+
+        thread_pool(const thread_pool&)=delete;
+        thread_pool(thread_pool&&)=delete;
+        thread_pool& operator= (const thread_pool&)=delete;
+        thread_pool& operator= (thread_pool&&)=delete;
+
+        /**
+         * @brief Post task for execution in one of worker threads.
+         * @param task Task to execute.
+         */
+        template <typename TaskT>
+        void post(TaskT&& task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _tasks.emplace_back(std::forward<TaskT>(task));
+            }
+            _cond.notify_one();
+        }
+
+        /**
+         * @brief Get number of worker threads.
+         * @return Number of worker threads.
+         */
+        size_t size() const noexcept
+        {
+            return _workers.size();
+        }
+
+        /**
+         * @brief Check if current thread is a worker thread of some thread pool.
+         * @return True if invoked from a task running in a thread pool.
+         */
+        static bool is_worker_thread() noexcept
+        {
+            return worker_flag();
+        }
+
+    private:
+
+        static bool& worker_flag() noexcept
+        {
+            static thread_local bool flag=false;
+            return flag;
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopped=true;
+            }
+            _cond.notify_all();
+            for (auto&& worker:_workers)
+            {
+                worker.join();
+            }
+        }
+
+        void run()
+        {
+            worker_flag()=true;
+            for (;;)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _cond.wait(lock,[this](){return _stopped || !_tasks.empty();});
+                    if (_tasks.empty())
+                    {
+                        return;
+                    }
+                    task=std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        std::deque<std::function<void()>> _tasks;
+        std::vector<std::thread> _workers;
+        bool _stopped=false;
+};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_THREAD_POOL_HPP
@@ -93,7 +93,7 @@ constexpr unwrap_object_impl unwrap_object{};
 struct unwrap_object_type_c_t
 {
     template <typename T>
-    constexpr auto operator ()(T) const
+    constexpr auto operator ()(const T&) const
     {
         return hana::type<unwrap_object_t<T>>{};
     }
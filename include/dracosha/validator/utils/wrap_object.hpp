@@ -19,6 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef DRACOSHA_VALIDATOR_WRAP_OBJECT_HPP
 #define DRACOSHA_VALIDATOR_WRAP_OBJECT_HPP
 
+#include <string>
+
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/utils/unwrap_object.hpp>
 #include <dracosha/validator/variadic_arg.hpp>
@@ -84,6 +86,126 @@ auto wrap_object_ref(T&& v) -> decltype(auto)
 
 //-------------------------------------------------------------
 
+/**
+ * @brief Wrap a reference to string key into object_wrapper.
+ *
+ * Strings and object_wrappers are replaced with object_wrappers of constant references, other keys are returned as is.
+ */
+struct wrap_key_ref_impl
+{
+    template <typename T>
+    auto operator () (const T& key) const -> decltype(auto)
+    {
+        return hana::eval_if(
+            std::is_same<std::decay_t<T>,std::string>{},
+            [&](auto&& _)
+            {
+                return object_wrapper<const std::string&>(_(key));
+            },
+            [&](auto&& _)
+            {
+                return wrap_object_ref(_(key));
+            }
+        );
+    }
+};
+constexpr wrap_key_ref_impl wrap_key_ref{};
+/**
+ * @brief Make a copy of member path where string keys are replaced with object_wrappers of references to the keys.
+ * @param path Member path.
+ * @return Path that can be copied without copying the keys.
+ *
+ * Paths are extended for each element of aggregations, thus using references to keys avoids
+ * copying and allocating strings when elements are validated. The original path must outlive the result.
+ */
+template <typename PathT>
+auto wrap_path_refs(const PathT& path)
+{
+    return hana::transform(path,wrap_key_ref);
+}
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Check if key is an object_wrapper of a reference.
+ */
+template <typename T, typename=hana::when<true>>
+struct is_key_ref : public std::false_type
+{};
+
+/**
+ * @brief Check if key is an object_wrapper of a reference.
+ *
+ * Specialization for object_wrappers except for variadic arguments.
+ */
+template <typename T>
+struct is_key_ref<T,hana::when<
+            hana::is_a<object_wrapper_tag,T>
+            &&
+            !std::is_base_of<variadic_arg_tag,T>::value
+        >>
+    : public std::is_reference<typename T::type>
+{};
+
+}
+
+/**
+ * @brief Copy a key that is wrapped into object_wrapper of reference.
+ *
+ * References to std::string are replaced with std::string, other references are replaced with object_wrappers of copies,
+ * other keys are copied as is. This is an inverse operation of wrap_key_ref.
+ */
+struct copy_key_ref_impl
+{
+    template <typename T>
+    auto operator () (const T& key) const
+    {
+        return hana::eval_if(
+            detail::is_key_ref<T>{},
+            [&](auto&& _)
+            {
+                return copy_value(unwrap_object(_(key)));
+            },
+            [&](auto&& _)
+            {
+                return _(key);
+            }
+        );
+    }
+
+    private:
+
+        static std::string copy_value(const std::string& val)
+        {
+            return val;
+        }
+
+        template <typename T>
+        static object_wrapper<T> copy_value(const T& val)
+        {
+            return object_wrapper<T>(T(val));
+        }
+};
+constexpr copy_key_ref_impl copy_key_ref{};
+
+/**
+ * @brief Make a copy of member path where references to keys are replaced with copies of the keys.
+ * @param path Member path, e.g. made with wrap_path_refs().
+ * @return Path that does not refer to keys of other paths.
+ *
+ * Used when a path must outlive the validator it was taken from, e.g. in structured reports.
+ */
+template <typename PathT>
+auto copy_path_keys(const PathT& path)
+{
+    return hana::transform(path,copy_key_ref);
+}
+
+//-------------------------------------------------------------
+
 DRACOSHA_VALIDATOR_NAMESPACE_END
 
 #endif // DRACOSHA_VALIDATOR_WRAP_OBJECT_HPP
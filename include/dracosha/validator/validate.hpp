@@ -27,6 +27,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/adapters/default_adapter.hpp>
 #include <dracosha/validator/adapters/reporting_adapter.hpp>
 #include <dracosha/validator/adapters/prevalidation_adapter.hpp>
+#include <dracosha/validator/reporting/structured_report.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
 
@@ -73,6 +74,28 @@ struct validate_t
                       ));
     }
 
+    /**
+     * @brief Validate object with validator and put validation result with structured error description to the last argument.
+     * @brief obj Object to validate.
+     * @brief validator Validator.
+     * @brief err Structured error report to put validation result to.
+     */
+    template <typename ObjectT, typename ValidatorT, typename FormatterT>
+    void operator() (
+            ObjectT&& obj,
+            ValidatorT&& validator,
+            basic_structured_error_report<FormatterT>& err
+        ) const
+    {
+        err.reset();
+        err.set_value(validator.apply(
+                          make_reporting_adapter(
+                              std::forward<ObjectT>(obj),
+                              make_structured_reporter(err)
+                          )
+                      ));
+    }
+
     /**
      * @brief Validate object with validator and throw validation_error if operation fails.
      * @brief obj Object to validate.
@@ -118,6 +141,31 @@ struct validate_t
                       ));
     }
 
+    /**
+     * @brief Pre-validate object's member with validator and put validation result with structured error description to the last argument.
+     * @brief member Path of the member to validate.
+     * @brief obj Object to validate.
+     * @brief validator Validator.
+     * @brief err Structured error report to put validation result to.
+     */
+    template <typename MemberT, typename ValueT, typename ValidatorT, typename FormatterT>
+    void operator() (
+            MemberT&& member,
+            ValueT&& val,
+            ValidatorT&& validator,
+            basic_structured_error_report<FormatterT>& err
+        ) const
+    {
+        err.reset();
+        err.set_value(validator.apply(
+                          make_prevalidation_adapter(
+                              std::forward<MemberT>(member),
+                              std::forward<ValueT>(val),
+                              make_structured_reporter(err)
+                          )
+                      ));
+    }
+
     /**
      * @brief Pre-validate object's member with validator and throw validation_error if operation fails.
      * @brief member Path of the member to validate.
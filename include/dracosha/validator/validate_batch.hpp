@@ -0,0 +1,370 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/validate_batch.hpp
+*
+*  Defines helpers for validation of sequences of objects.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef DRACOSHA_VALIDATOR_VALIDATE_BATCH_HPP
+#define DRACOSHA_VALIDATOR_VALIDATE_BATCH_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include <dracosha/validator/config.hpp>
+#include <dracosha/validator/utils/thread_pool.hpp>
+#include <dracosha/validator/utils/parallel_while_each.hpp>
+#include <dracosha/validator/adapters/rebindable_adapter.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+
+DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Results of batch validation.
+ *
+ * Statuses of objects are kept in a bitmap where a set bit means that the object passed validation.
+ * If reports are enabled then a report is constructed for each object that failed validation.
+ */
+class batch_results
+{
+    public:
+
+        /**
+         * @brief Number of object statuses in a single word of bitmap.
+         */
+        constexpr static const size_t word_bits=64;
+
+        /**
+         * @brief Constructor.
+         * @param with_reports Construct reports for objects that fail validation.
+         */
+        explicit batch_results(bool with_reports=false) noexcept
+            : _size(0),
+              _with_reports(with_reports)
+        {}
+
+        /**
+         * @brief Reset results and prepare them for validation of a sequence of objects.
+         * @param size Number of objects in the sequence.
+         */
+        void reset(size_t size)
+        {
+            _size=size;
+            _bitmap.assign((size+word_bits-1)/word_bits,0);
+            if (_with_reports)
+            {
+                _reports.clear();
+                _reports.resize(size);
+            }
+        }
+
+        /**
+         * @brief Set status of object.
+         * @param index Index of object in the sequence.
+         * @param ok True if object passed validation.
+         *
+         * Statuses of objects that reside in different words of bitmap can be set concurrently.
+         */
+        void set(size_t index, bool ok) noexcept
+        {
+            auto mask=uint64_t(1)<<(index%word_bits);
+            auto& word=_bitmap[index/word_bits];
+            if (ok)
+            {
+                word|=mask;
+            }
+            else
+            {
+                word&=~mask;
+            }
+        }
+
+        /**
+         * @brief Check if object passed validation.
+         * @param index Index of object in the sequence.
+         * @return Validation result.
+         */
+        bool ok(size_t index) const noexcept
+        {
+            return (_bitmap[index/word_bits]>>(index%word_bits))&1;
+        }
+
+        /**
+         * @brief Check if object passed validation.
+         * @param index Index of object in the sequence.
+         * @return Validation result.
+         */
+        bool operator[] (size_t index) const noexcept
+        {
+            return ok(index);
+        }
+
+        /**
+         * @brief Get number of validated objects.
+         * @return Number of objects.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /**
+         * @brief Count objects that failed validation.
+         * @return Number of failed objects.
+         */
+        size_t failed_count() const noexcept
+        {
+            size_t passed=0;
+            for (auto word:_bitmap)
+            {
+                for (;word!=0;word&=word-1)
+                {
+                    ++passed;
+                }
+            }
+            return _size-passed;
+        }
+
+        /**
+         * @brief Check if all objects passed validation.
+         * @return Validation result.
+         */
+        bool all_ok() const noexcept
+        {
+            return failed_count()==0;
+        }
+
+        /**
+         * @brief Get bitmap of validation statuses.
+         * @return Bitmap where bit i%64 of word i/64 is set if object i passed validation.
+         */
+        const std::vector<uint64_t>& bitmap() const noexcept
+        {
+            return _bitmap;
+        }
+
+        /**
+         * @brief Check if reports are constructed for failed objects.
+         * @return True if reports are enabled.
+         */
+        bool with_reports() const noexcept
+        {
+            return _with_reports;
+        }
+
+        /**
+         * @brief Get report of object.
+         * @param index Index of object in the sequence.
+         * @return Report describing validation error, empty if the object passed validation or reports are disabled.
+         */
+        const std::string& report(size_t index) const
+        {
+            static const std::string empty;
+            return _with_reports ? _reports[index] : empty;
+        }
+
+        /**
+         * @brief Get writable report of object.
+         * @param index Index of object in the sequence.
+         * @return Report string.
+         */
+        std::string& report_dst(size_t index)
+        {
+            return _reports[index];
+        }
+
+    private:
+
+        size_t _size;
+        bool _with_reports;
+        std::vector<uint64_t> _bitmap;
+        std::vector<std::string> _reports;
+};
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Validator of objects of batch that reuses the same adapter for all objects.
+ */
+template <typename IteratorT, typename ValidatorT>
+class batch_validator
+{
+    public:
+
+        using object_type=std::remove_reference_t<typename std::iterator_traits<IteratorT>::reference>;
+
+        batch_validator(const ValidatorT& validator, batch_results& results)
+            : _validator(validator),
+              _results(results),
+              _adapter(nullptr)
+        {}
+
+        bool operator() (size_t index, object_type& obj)
+        {
+            _adapter.rebind(obj);
+            bool ok=_validator.apply(_adapter);
+            if (!ok && _results.with_reports())
+            {
+                // validate failed object once again to construct the report
+                _validator.apply(make_reporting_adapter(obj,_results.report_dst(index)));
+            }
+            _results.set(index,ok);
+            return true;
+        }
+
+    private:
+
+        const ValidatorT& _validator;
+        batch_results& _results;
+        rebindable_adapter<object_type> _adapter;
+};
+
+}
+
+/**
+ * @brief Implementation of a helper to invoke validate_batch() as a single callable.
+ */
+struct validate_batch_t
+{
+    /**
+     * @brief Validate sequence of objects with validator.
+     * @param first Iterator of the first object.
+     * @param last Iterator past the last object.
+     * @param validator Validator.
+     * @param results Results where to put validation statuses and reports.
+     * @return True if all objects passed validation.
+     */
+    template <typename IteratorT, typename ValidatorT>
+    bool operator() (
+            IteratorT first,
+            IteratorT last,
+            const ValidatorT& validator,
+            batch_results& results
+        ) const
+    {
+        results.reset(static_cast<size_t>(std::distance(first,last)));
+        detail::batch_validator<IteratorT,ValidatorT> handler(validator,results);
+        size_t index=0;
+        for (auto it=first;it!=last;++it,++index)
+        {
+            handler(index,*it);
+        }
+        return results.all_ok();
+    }
+
+    /**
+     * @brief Validate sequence of objects with validator splitting the sequence into chunks processed in a thread pool.
+     * @param first Iterator of the first object.
+     * @param last Iterator past the last object.
+     * @param validator Validator.
+     * @param results Results where to put validation statuses and reports.
+     * @param pool Thread pool.
+     * @param chunk_size Minimal number of objects processed by a worker at once, rounded up to multiple of 64.
+     * @return True if all objects passed validation.
+     *
+     * Chunks are processed in parallel only for random access iterators, otherwise objects are validated sequentially.
+     * Operators and lazy operands used in validator must be thread safe.
+     */
+    template <typename IteratorT, typename ValidatorT>
+    bool operator() (
+            IteratorT first,
+            IteratorT last,
+            const ValidatorT& validator,
+            batch_results& results,
+            thread_pool& pool,
+            size_t chunk_size=1024
+        ) const
+    {
+        return parallel(first,last,validator,results,pool,chunk_size,
+                        typename std::iterator_traits<IteratorT>::iterator_category{});
+    }
+
+    private:
+
+        template <typename IteratorT, typename ValidatorT>
+        bool parallel(
+                IteratorT first,
+                IteratorT last,
+                const ValidatorT& validator,
+                batch_results& results,
+                thread_pool& pool,
+                size_t chunk_size,
+                std::random_access_iterator_tag
+            ) const
+        {
+            // chunks must not share words of bitmap
+            chunk_size=std::max(chunk_size,size_t(1));
+            chunk_size=(chunk_size+batch_results::word_bits-1)/batch_results::word_bits*batch_results::word_bits;
+
+            auto count=static_cast<size_t>(std::distance(first,last));
+            if (count<=chunk_size || pool.size()==0)
+            {
+                return (*this)(first,last,validator,results);
+            }
+
+            results.reset(count);
+            bool dummy=true;
+            parallel_while_each(
+                pool,
+                count,
+                chunk_size,
+                [](bool ok)
+                {
+                    return ok;
+                },
+                [&]()
+                {
+                    return [handler=detail::batch_validator<IteratorT,ValidatorT>(validator,results),first](size_t index) mutable
+                    {
+                        return handler(index,first[index]);
+                    };
+                },
+                dummy
+            );
+            return results.all_ok();
+        }
+
+        template <typename IteratorT, typename ValidatorT, typename CategoryT>
+        bool parallel(
+                IteratorT first,
+                IteratorT last,
+                const ValidatorT& validator,
+                batch_results& results,
+                thread_pool&,
+                size_t,
+                CategoryT
+            ) const
+        {
+            return (*this)(first,last,validator,results);
+        }
+};
+
+/**
+ * @brief Helper to invoke validate_batch() as a single callable.
+ */
+constexpr validate_batch_t validate_batch{};
+
+//-------------------------------------------------------------
+
+DRACOSHA_VALIDATOR_NAMESPACE_END
+
+#endif // DRACOSHA_VALIDATOR_VALIDATE_BATCH_HPP
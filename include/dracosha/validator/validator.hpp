@@ -43,6 +43,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/make_validator.hpp>
 #include <dracosha/validator/member.hpp>
 #include <dracosha/validator/master_sample.hpp>
+#include <dracosha/validator/indexed_master_sample.hpp>
 #include <dracosha/validator/properties.hpp>
 #include <dracosha/validator/operators.hpp>
 #include <dracosha/validator/operand.hpp>
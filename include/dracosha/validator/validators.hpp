@@ -22,8 +22,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <dracosha/validator/config.hpp>
 #include <dracosha/validator/utils/adjust_storable_type.hpp>
 #include <dracosha/validator/utils/reference_wrapper.hpp>
+#include <dracosha/validator/lazy.hpp>
 #include <dracosha/validator/adapters/default_adapter.hpp>
 #include <dracosha/validator/adapters/make_intermediate_adapter.hpp>
+#include <dracosha/validator/adapters/impl/failure_collector.hpp>
 #include <dracosha/validator/prepend_super_member.hpp>
 
 DRACOSHA_VALIDATOR_NAMESPACE_BEGIN
@@ -122,7 +124,10 @@ class validator_t
         template <typename AdapterT, typename ... Args>
         auto apply(AdapterT&& adpt, Args&&... args) const
         {
-            return _fn(ensure_adapter(std::forward<AdapterT>(adpt)),std::forward<Args>(args)...);
+            detail::lazy_pass_scope scope;
+            auto&& adapter=ensure_adapter(std::forward<AdapterT>(adpt));
+            failures_pass_scope<std::decay_t<decltype(adapter)>> pass(adapter);
+            return pass.close(_fn(adapter,std::forward<Args>(args)...));
         }
 
         /**
@@ -156,6 +161,15 @@ class validator_t
             return hint(std::forward<T>(h));
         }
 
+        /**
+         * @brief Get embedded validation handler.
+         * @return Validation handler.
+         */
+        const HandlerT& handler() const noexcept
+        {
+            return _fn;
+        }
+
     private:
 
         HandlerT _fn;
@@ -198,19 +212,24 @@ class validator_with_member_t
         template <typename AdapterT>
         auto apply(AdapterT&& adpt) const
         {
-            return apply_member(ensure_adapter(std::forward<AdapterT>(adpt)),_prepared_validator,_member);
+            detail::lazy_pass_scope scope;
+            auto&& adapter=ensure_adapter(std::forward<AdapterT>(adpt));
+            failures_pass_scope<std::decay_t<decltype(adapter)>> pass(adapter);
+            return pass.close(apply_member(adapter,_prepared_validator,_member));
         }
 
         template <typename AdapterT, typename SuperMemberT>
         auto apply(AdapterT&& adpt, SuperMemberT&& super) const
         {
+            detail::lazy_pass_scope scope;
             auto&& adapter=ensure_adapter(std::forward<AdapterT>(adpt));
+            failures_pass_scope<std::decay_t<decltype(adapter)>> pass(adapter);
             auto tmp_adapter=make_intermediate_adapter(adapter,path_of(super));
-            return apply_member(
+            return pass.close(apply_member(
                         tmp_adapter,
                         _prepared_validator,
                         prepend_super_member(std::forward<SuperMemberT>(super),_member)
-                    );
+                    ));
         }
 
         /**
@@ -244,6 +263,24 @@ class validator_with_member_t
             return hint(std::forward<T>(h));
         }
 
+        /**
+         * @brief Get member this validator is bound to.
+         * @return Member.
+         */
+        const MemberT& member() const noexcept
+        {
+            return _member;
+        }
+
+        /**
+         * @brief Get validator to apply to the member.
+         * @return Prepared validator.
+         */
+        const ValidatorT& prepared_validator() const noexcept
+        {
+            return _prepared_validator;
+        }
+
     private:
 
         MemberT _member;
@@ -12,6 +12,7 @@ SET (VALIDATOR_TEST_SOURCES
     ${VALIDATOR_TEST_SRC}/teststrings.cpp
     ${VALIDATOR_TEST_SRC}/testformatter.cpp
     ${VALIDATOR_TEST_SRC}/testtranslator_ru.cpp
+    ${VALIDATOR_TEST_SRC}/testfrozentranslator.cpp
     ${VALIDATOR_TEST_SRC}/testlexicographical.cpp
     ${VALIDATOR_TEST_SRC}/testoperatorin.cpp
     ${VALIDATOR_TEST_SRC}/testregex.cpp
@@ -34,6 +35,14 @@ SET (VALIDATOR_TEST_SOURCES
     ${VALIDATOR_TEST_SRC}/testvaluetransformer.cpp
     ${VALIDATOR_TEST_SRC}/testtree.cpp
     ${VALIDATOR_TEST_SRC}/testpointers.cpp
+    ${VALIDATOR_TEST_SRC}/testparallel.cpp
+    ${VALIDATOR_TEST_SRC}/testvalidatebatch.cpp
+    ${VALIDATOR_TEST_SRC}/testcompile.cpp
+    ${VALIDATOR_TEST_SRC}/testmemberlookupcache.cpp
+    ${VALIDATOR_TEST_SRC}/teststructuredreport.cpp
+    ${VALIDATOR_TEST_SRC}/testcollectfailures.cpp
+    ${VALIDATOR_TEST_SRC}/testanyvalidator.cpp
+    ${VALIDATOR_TEST_SRC}/testindexedmastersample.cpp
 )
 
 TARGET_SOURCES(${PROJECT_NAME} PUBLIC ${VALIDATOR_TEST_SOURCES})
@@ -43,5 +52,12 @@ IF (MINGW)
     SET_SOURCE_FILES_PROPERTIES(${VALIDATOR_TEST_SOURCES} PROPERTIES COMPILE_FLAGS -Og)
 ENDIF (MINGW)
 
+# Test of zero allocations replaces global operator new and operator delete,
+# so it is built as a separate executable in order not to affect other tests
+SET (VALIDATOR_ZERO_ALLOCATION_TEST ${PROJECT_NAME}-zeroallocation)
+ADD_EXECUTABLE(${VALIDATOR_ZERO_ALLOCATION_TEST} ${VALIDATOR_TEST_SRC}/main.cpp ${VALIDATOR_TEST_SRC}/testzeroallocation.cpp)
+TARGET_LINK_LIBRARIES(${VALIDATOR_ZERO_ALLOCATION_TEST} dracoshavalidator ${Boost_LIBRARIES})
+ADD_TEST(${VALIDATOR_ZERO_ALLOCATION_TEST} ${VALIDATOR_ZERO_ALLOCATION_TEST} --log_level=test_suite)
+
 FUNCTION(TestValidator)
 ENDFUNCTION(TestValidator)
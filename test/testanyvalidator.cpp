@@ -0,0 +1,127 @@
+#include <map>
+#include <vector>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/any_validator.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace
+{
+using map_type=std::map<std::string,size_t>;
+using adapter_type=default_adapter<const map_type&>;
+}
+
+BOOST_AUTO_TEST_SUITE(TestAnyValidator)
+
+BOOST_AUTO_TEST_CASE(CheckValidation)
+{
+    map_type m1={{"field1",1},{"field2",20}};
+    auto a1=make_default_adapter(static_cast<const map_type&>(m1));
+    static_assert(std::is_same<decltype(a1),adapter_type>::value,"");
+
+    any_validator<adapter_type> v0;
+    BOOST_CHECK(v0.empty());
+    BOOST_CHECK(v0.apply(a1).value()==status::code::ignore);
+
+    any_validator<adapter_type> v1(validator(_["field1"](eq,1)));
+    BOOST_CHECK(!v1.empty());
+    BOOST_CHECK(v1.is_inline());
+    BOOST_CHECK(v1.apply(a1));
+
+    // large validator is allocated on heap
+    auto large=validator(
+                _["field1"](gte,1),
+                _["field2"](lt,100),
+                _["field2"](ne,30),
+                _["field1"](lt,5)
+            );
+    static_assert(!any_validator<adapter_type>::is_inline_validator<decltype(large)>::value,"");
+    any_validator<adapter_type> v2(large);
+    BOOST_CHECK(!v2.is_inline());
+    BOOST_CHECK(v2.apply(a1));
+    m1["field2"]=30;
+    BOOST_CHECK(!v2.apply(a1));
+    m1["field2"]=20;
+
+    // move
+    any_validator<adapter_type> v3(std::move(v1));
+    BOOST_CHECK(v1.empty());
+    BOOST_CHECK(v3.is_inline());
+    BOOST_CHECK(v3.apply(a1));
+    v3=std::move(v2);
+    BOOST_CHECK(v2.empty());
+    BOOST_CHECK(!v3.is_inline());
+    BOOST_CHECK(v3.apply(a1));
+    v3.reset();
+    BOOST_CHECK(v3.empty());
+
+    // buffer of custom size
+    any_validator<adapter_type,512> v4(large);
+    BOOST_CHECK(v4.is_inline());
+    BOOST_CHECK(v4.apply(a1));
+}
+
+BOOST_AUTO_TEST_CASE(CheckVectorAndArena)
+{
+    map_type m1={{"field1",1},{"field2",20}};
+    auto a1=make_default_adapter(static_cast<const map_type&>(m1));
+
+    validator_arena arena(1024);
+    BOOST_CHECK_EQUAL(arena.allocated(),0);
+
+    std::vector<any_validator<adapter_type>> rules;
+    for (size_t i=0;i<100;i++)
+    {
+        // operands given by lvalues are kept by references, so temporary copies are used
+        auto x=i;
+        if (i%2==0)
+        {
+            rules.emplace_back(validator(_["field1"](lt,size_t(x))));
+        }
+        else
+        {
+            rules.emplace_back(
+                validator(
+                    _["field1"](lt,x+1),
+                    _["field2"](gte,size_t(x)),
+                    _["field2"](ne,x+1),
+                    _["field1"](gte,0)
+                ),
+                arena
+            );
+        }
+    }
+    BOOST_CHECK_GT(arena.allocated(),0);
+    BOOST_CHECK_GT(arena.block_count(),1);
+
+    size_t passed=0;
+    for (auto&& rule:rules)
+    {
+        if (rule.apply(a1))
+        {
+            ++passed;
+        }
+    }
+    // even rules pass for i>=2, odd rules pass for i<=20 except i=19
+    BOOST_CHECK_EQUAL(passed,49+10-1);
+
+    rules.clear();
+}
+
+BOOST_AUTO_TEST_CASE(CheckReportingAdapter)
+{
+    map_type m1={{"field1",1}};
+    std::string rep;
+    auto ra=make_reporting_adapter(m1,rep);
+
+    any_validator<decltype(ra)> v1(validator(_["field1"](gte,10)));
+    BOOST_CHECK(!v1.apply(ra));
+    BOOST_CHECK_EQUAL(rep,"field1 must be greater than or equal to 10");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,241 @@
+#include <map>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/validate.hpp>
+#include <dracosha/validator/compile.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+#include <dracosha/validator/reporting/structured_report.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestCollectFailures)
+
+namespace {
+
+struct ThrowingObject
+{
+    int counter() const
+    {
+        if (fail)
+        {
+            throw std::runtime_error("failed to get counter");
+        }
+        return value;
+    }
+
+    int value=1;
+    bool fail=false;
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(counter)
+
+}
+
+BOOST_AUTO_TEST_CASE(CheckAndAggregation)
+{
+    std::map<std::string,size_t> m1={{"field1",10},{"field2",20},{"field3",30}};
+    auto v=validator(
+                _["field1"](gte,100),
+                _["field2"](eq,20),
+                _["field3"](lt,5)
+            );
+
+    std::string rep;
+    auto ra=make_reporting_adapter(m1,rep);
+    BOOST_CHECK(!ra.traits().is_collect_all_failures());
+    BOOST_CHECK(!v.apply(ra));
+    BOOST_CHECK_EQUAL(rep,"field1 must be greater than or equal to 100");
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),0);
+
+    rep.clear();
+    ra.traits().set_collect_all_failures(true);
+    BOOST_CHECK_EQUAL(ra.traits().failures_budget(),failure_collector::default_failures_budget);
+    BOOST_CHECK(!v.apply(ra));
+    BOOST_CHECK_EQUAL(rep,"field1 must be greater than or equal to 100 AND field3 must be less than 5");
+    BOOST_CHECK_EQUAL(ra.traits().collected_failure_count(),2);
+    BOOST_CHECK_EQUAL(ra.traits().skipped_failure_count(),0);
+
+    // counters are reset in each validation pass
+    rep.clear();
+    m1["field3"]=1;
+    BOOST_CHECK(!v.apply(ra));
+    BOOST_CHECK_EQUAL(rep,"field1 must be greater than or equal to 100");
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),1);
+
+    rep.clear();
+    m1["field1"]=100;
+    BOOST_CHECK(v.apply(ra));
+    BOOST_CHECK(rep.empty());
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),0);
+
+    // default adapter
+    m1["field1"]=10;
+    m1["field3"]=30;
+    auto a1=make_default_adapter(m1);
+    a1.traits().set_collect_all_failures(true);
+    BOOST_CHECK(!v.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),2);
+
+    // counters are reset by validators without aggregations
+    auto v2=validator(_["field2"](gte,100));
+    BOOST_CHECK(!v2.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),1);
+    auto v3=validator(_["field2"](gte,1));
+    BOOST_CHECK(v3.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),0);
+    BOOST_CHECK(!v.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),2);
+
+    rep.clear();
+    BOOST_CHECK(!v.apply(ra));
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),2);
+    BOOST_CHECK(!v2.apply(ra));
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),1);
+    BOOST_CHECK(v3.apply(ra));
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),0);
+}
+
+BOOST_AUTO_TEST_CASE(CheckBudget)
+{
+    std::map<std::string,size_t> m1={{"field1",10},{"field2",20},{"field3",30},{"field4",40}};
+    auto v=validator(
+                _["field1"](gte,100),
+                _["field2"](gte,100),
+                _["field3"](gte,100),
+                _["field4"](gte,100)
+            );
+
+    std::string rep;
+    auto ra=make_reporting_adapter(m1,rep);
+    ra.traits().set_collect_all_failures(true,2);
+    BOOST_CHECK(!v.apply(ra));
+    BOOST_CHECK_EQUAL(rep,"field1 must be greater than or equal to 100 AND field2 must be greater than or equal to 100");
+    BOOST_CHECK_EQUAL(ra.traits().collected_failure_count(),2);
+    BOOST_CHECK_EQUAL(ra.traits().skipped_failure_count(),2);
+    BOOST_CHECK_EQUAL(ra.traits().failure_count(),4);
+
+    // elements beyond the budget are counted but not reported
+    std::map<std::string,std::vector<size_t>> m2={{"field1",{1,2,3,4,5,6,7,8,9,10}}};
+    auto v2=validator(_["field1"][ALL](gte,8));
+    structured_error_report err;
+    auto ra2=make_reporting_adapter(m2,make_structured_reporter(err));
+    ra2.traits().set_collect_all_failures(true,3);
+    BOOST_CHECK(!v2.apply(ra2));
+    BOOST_CHECK_EQUAL(ra2.traits().collected_failure_count(),3);
+    BOOST_CHECK_EQUAL(ra2.traits().skipped_failure_count(),4);
+    BOOST_CHECK_EQUAL(err.message(),"element #0 of field1 must be greater than or equal to 8 AND element #1 of field1 must be greater than or equal to 8 AND element #2 of field1 must be greater than or equal to 8");
+}
+
+BOOST_AUTO_TEST_CASE(CheckElementAggregations)
+{
+    std::map<std::string,std::vector<size_t>> m1={{"field1",{1,2,3,4,5}}};
+
+    auto a1=make_default_adapter(m1);
+    a1.traits().set_collect_all_failures(true);
+
+    BOOST_CHECK(!validator(_["field1"][ALL](gte,3)).apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),2);
+
+    BOOST_CHECK(validator(_["field1"][ALL](gte,1)).apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),0);
+
+    // ANY is counted as a single failure
+    BOOST_CHECK(!validator(_["field1"][ANY](gte,10)).apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),1);
+
+    // OR and NOT are counted as single failures
+    BOOST_CHECK(!validator(
+                    _["field1"][ALL](gte,4),
+                    _["field1"][ANY](gte,10) ^OR^ _["field1"](size(gte,10)),
+                    NOT(_["field1"][ALL](lt,10))
+                ).apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),5);
+
+    // ALL nested into ALL
+    std::map<std::string,std::map<std::string,size_t>> m2={
+        {"field1",{{"a",1},{"b",2}}},
+        {"field2",{{"a",10},{"b",20}}},
+        {"field3",{{"a",1},{"b",20}}}
+    };
+    auto a2=make_default_adapter(m2);
+    a2.traits().set_collect_all_failures(true);
+    BOOST_CHECK(!validator(_[ALL][ALL](gte,5)).apply(a2));
+    BOOST_CHECK_EQUAL(a2.traits().failure_count(),3);
+}
+
+BOOST_AUTO_TEST_CASE(CheckListedElements)
+{
+    // each failed element of ALL aggregation is reported by its key
+    std::map<std::string,std::map<std::string,size_t>> m1={
+        {"field1",{{"a",1},{"b",2},{"c",10}}}
+    };
+    std::string rep;
+    auto ra1=make_reporting_adapter(m1,rep);
+    ra1.traits().set_collect_all_failures(true);
+    BOOST_CHECK(!validator(_["field1"][ALL](gte,5)).apply(ra1));
+    BOOST_CHECK_EQUAL(ra1.traits().failure_count(),2);
+    BOOST_CHECK_EQUAL(rep,"a of field1 must be greater than or equal to 5 AND b of field1 must be greater than or equal to 5");
+
+    // ANY is not expanded
+    rep.clear();
+    BOOST_CHECK(!validator(_["field1"][ANY](gte,50)).apply(ra1));
+    BOOST_CHECK_EQUAL(rep,"at least one element of field1 must be greater than or equal to 50");
+
+    // structured report records failed elements within AND aggregation
+    std::map<std::string,std::vector<size_t>> m2={{"field1",{1,20,3}}};
+    structured_error_report err;
+    auto ra2=make_reporting_adapter(m2,make_structured_reporter(err));
+    ra2.traits().set_collect_all_failures(true);
+    BOOST_CHECK(!validator(_["field1"][ALL](gte,5)).apply(ra2));
+    BOOST_CHECK_EQUAL(err.failure_count(),2);
+    BOOST_CHECK_EQUAL(err.message(),"element #0 of field1 must be greater than or equal to 5 AND element #2 of field1 must be greater than or equal to 5");
+}
+
+BOOST_AUTO_TEST_CASE(CheckScopeOnException)
+{
+    std::vector<ThrowingObject> v1(3);
+    auto a1=make_default_adapter(v1);
+    a1.traits().set_collect_all_failures(true);
+    auto v=validator(_[ALL](counter(gte,5)));
+
+    v1[1].fail=true;
+    BOOST_CHECK_THROW(v.apply(a1),std::runtime_error);
+
+    // scopes are closed when validation throws, so the next validation pass starts with reset counters
+    v1[1].fail=false;
+    BOOST_CHECK(!v.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),3);
+
+    // reports suspended because of exhausted budget are resumed when validation throws
+    std::string rep;
+    auto ra1=make_reporting_adapter(v1,rep);
+    ra1.traits().set_collect_all_failures(true,1);
+    v1[2].fail=true;
+    BOOST_CHECK_THROW(v.apply(ra1),std::runtime_error);
+    BOOST_CHECK(!ra1.traits().reporter().is_suspended());
+}
+
+BOOST_AUTO_TEST_CASE(CheckCompiled)
+{
+    std::map<std::string,size_t> m1={{"field1",10},{"field2",20},{"field3",30}};
+    auto v=compile(validator(
+                _["field1"](gte,100),
+                _["field2"](eq,20),
+                _["field3"](lt,5)
+            ));
+
+    auto a1=make_default_adapter(m1);
+    BOOST_CHECK(!v.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),0);
+
+    a1.traits().set_collect_all_failures(true);
+    BOOST_CHECK(!v.apply(a1));
+    BOOST_CHECK_EQUAL(a1.traits().failure_count(),2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,171 @@
+#include <map>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/compile.hpp>
+#include <dracosha/validator/validate.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestCompile)
+
+namespace {
+
+struct CountingObject
+{
+    int counter() const
+    {
+        ++count;
+        return value;
+    }
+
+    int value=10;
+    mutable size_t count=0;
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(counter)
+
+}
+
+BOOST_AUTO_TEST_CASE(CheckFoldAndGroup)
+{
+    auto v=validator(
+                _["field1"](gte,0),
+                _["field1"](lte,100),
+                validator(
+                    _["field2"](gt,1),
+                    _["field2"](lt,10)
+                ) ^AND^ _["field3"](eq,5)
+            );
+    auto cv=compile(v);
+    BOOST_CHECK_EQUAL(cv.size(),5);
+    BOOST_CHECK_EQUAL(cv.group_count(),3);
+
+    std::vector<std::map<std::string,int>> samples{
+        {{"field1",50},{"field2",5},{"field3",5}},
+        {{"field1",-1},{"field2",5},{"field3",5}},
+        {{"field1",101},{"field2",5},{"field3",5}},
+        {{"field1",50},{"field2",1},{"field3",5}},
+        {{"field1",50},{"field2",10},{"field3",5}},
+        {{"field1",50},{"field2",5},{"field3",6}}
+    };
+    for (auto&& sample:samples)
+    {
+        BOOST_CHECK_EQUAL(bool(cv.apply(sample)),bool(v.apply(sample)));
+    }
+    BOOST_CHECK(cv.apply(samples[0]));
+    BOOST_CHECK(!cv.apply(samples[5]));
+
+    // not adjacent checks of the same member are not grouped
+    auto v2=validator(
+                _["field1"](gte,0),
+                _["field2"](gt,1),
+                _["field1"](lte,100)
+            );
+    auto cv2=compile(v2);
+    BOOST_CHECK_EQUAL(cv2.size(),3);
+    BOOST_CHECK_EQUAL(cv2.group_count(),3);
+    for (auto&& sample:samples)
+    {
+        BOOST_CHECK_EQUAL(bool(cv2.apply(sample)),bool(v2.apply(sample)));
+    }
+
+    // single validator
+    auto v3=validator(_["field1"](gte,0));
+    auto cv3=compile(v3);
+    BOOST_CHECK_EQUAL(cv3.size(),1);
+    BOOST_CHECK(cv3.apply(samples[0]));
+    BOOST_CHECK(!cv3.apply(samples[1]));
+}
+
+BOOST_AUTO_TEST_CASE(CheckMemberFetchedOnce)
+{
+    auto v=validator(
+                _[counter](gte,0),
+                _[counter](lte,100),
+                _[counter](ne,50)
+            );
+    auto cv=compile(v);
+    BOOST_CHECK_EQUAL(cv.group_count(),1);
+
+    CountingObject obj;
+    BOOST_CHECK(v.apply(obj));
+    auto original_count=obj.count;
+    BOOST_CHECK_EQUAL(original_count,3);
+
+    obj.count=0;
+    BOOST_CHECK(cv.apply(obj));
+    BOOST_CHECK_EQUAL(obj.count,1);
+
+    obj.count=0;
+    obj.value=50;
+    BOOST_CHECK(!cv.apply(obj));
+    BOOST_CHECK_EQUAL(obj.count,1);
+}
+
+BOOST_AUTO_TEST_CASE(CheckMemberNotFound)
+{
+    auto v=validator(
+                _["field1"](gte,0),
+                _["field1"](lte,100),
+                _["field2"](eq,1)
+            );
+    auto cv=compile(v);
+
+    std::map<std::string,int> m1{{"field2",1}};
+    auto a1=make_default_adapter(m1);
+    a1.set_check_member_exists_before_validation(true);
+    BOOST_CHECK(v.apply(a1));
+    BOOST_CHECK(cv.apply(a1));
+
+    a1.set_unknown_member_mode(if_member_not_found::abort);
+    BOOST_CHECK(!v.apply(a1));
+    BOOST_CHECK(!cv.apply(a1));
+}
+
+BOOST_AUTO_TEST_CASE(CheckCompiledReports)
+{
+    auto v=validator(
+                _["field1"](gte,0),
+                _["field1"](lte,100),
+                _["field2"](eq,1)
+            );
+    auto cv=compile(v);
+
+    std::map<std::string,int> m1{{"field1",200},{"field2",1}};
+
+    std::string rep1;
+    BOOST_CHECK(!cv.apply(make_reporting_adapter(m1,rep1)));
+    std::string rep2;
+    BOOST_CHECK(!v.apply(make_reporting_adapter(m1,rep2)));
+    BOOST_CHECK_EQUAL(rep1,rep2);
+    BOOST_CHECK_EQUAL(rep1,"field1 must be less than or equal to 100");
+
+    error_report err;
+    validate(m1,cv,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),rep1);
+}
+
+BOOST_AUTO_TEST_CASE(CheckNestedCompiled)
+{
+    auto cv=compile(
+                validator(
+                    _["field1"](gte,0),
+                    _["field1"](lte,100)
+                )
+            );
+    auto v=validator(
+                _["level1"](cv)
+            );
+
+    std::map<std::string,std::map<std::string,int>> m1{{"level1",{{"field1",10}}}};
+    BOOST_CHECK(v.apply(m1));
+    m1["level1"]["field1"]=1000;
+    BOOST_CHECK(!v.apply(m1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
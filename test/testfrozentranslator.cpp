@@ -0,0 +1,106 @@
+#include <string>
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+#include <dracosha/validator/reporting/frozen_translator.hpp>
+#include <dracosha/validator/reporting/extend_translator.hpp>
+
+#include <dracosha/validator/reporting/locale/ru.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestFrozenTranslator)
+
+BOOST_AUTO_TEST_CASE(CheckMappedStrings)
+{
+    mapped_translator tr(std::map<std::string,std::string>{{"one","один"},{"two","два"}});
+    frozen_translator frozen(tr);
+    BOOST_CHECK_EQUAL(frozen.size(),2);
+
+    BOOST_CHECK_EQUAL(frozen("one").text(),"один");
+    BOOST_CHECK_EQUAL(frozen("two").text(),"два");
+    BOOST_CHECK_EQUAL(frozen("three").text(),"three");
+    BOOST_CHECK(frozen.translate("one"));
+    BOOST_CHECK(!frozen.translate("three"));
+
+    BOOST_CHECK(frozen.lookup("one")==string_view("один"));
+    BOOST_CHECK(frozen.lookup("three")==string_view("three"));
+    BOOST_REQUIRE(frozen.find("two")!=nullptr);
+    BOOST_CHECK_EQUAL(frozen.find("two")->text(),"два");
+    BOOST_CHECK(frozen.find("three")==nullptr);
+
+    // index of copy refers to its own phrases
+    frozen_translator copy;
+    BOOST_CHECK(copy.empty());
+    BOOST_CHECK(copy.find("one")==nullptr);
+    copy=frozen;
+    frozen.reset();
+    BOOST_CHECK(frozen.empty());
+    BOOST_CHECK(frozen.find("one")==nullptr);
+    BOOST_CHECK(copy.lookup("one")==string_view("один"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckGrammarCategories)
+{
+    const auto& tr=validator_translator_ru();
+    const auto& frozen=validator_frozen_translator_ru();
+    BOOST_CHECK_EQUAL(frozen.size(),tr.phrases().size());
+
+    // selections of frozen translator must be the same as of phrase translator for all combinations of categories
+    size_t mismatches=0;
+    for (auto&& it:tr.phrases())
+    {
+        for (grammar_categories cats=0;cats<(grammar_categories(1)<<(grammar_ru::predlozhny_padezh+1));cats++)
+        {
+            auto expected=tr(it.first,cats);
+            auto phrase=frozen.find(it.first,cats);
+            if (phrase==nullptr || phrase->text()!=expected.text() || phrase->grammar_cats()!=expected.grammar_cats())
+            {
+                ++mismatches;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(mismatches,0);
+
+    BOOST_CHECK_EQUAL(frozen(string_empty,grammar_categories_bitmask(grammar_ru::zhensky_rod)).text(),"должна быть пустой");
+    BOOST_CHECK_EQUAL(frozen(string_empty,grammar_categories_bitmask(grammar_ru::mn_chislo)).text(),"должны быть пустыми");
+
+    // more categories than can be resolved in advance
+    phrase_translator m;
+    m["id"]={
+        {"default"},
+        {"first",grammar_ru::muzhskoy_rod,grammar_ru::zhensky_rod,grammar_ru::sredny_rod,grammar_ru::mn_chislo,grammar_ru::imenitelny_padezh},
+        {"second",grammar_ru::roditelny_padezh,grammar_ru::datelny_padezh,grammar_ru::vinitelny_padezh,grammar_ru::tvoritelny_padezh,grammar_ru::predlozhny_padezh}
+    };
+    frozen_translator f1(m);
+    BOOST_CHECK_EQUAL(f1("id").text(),"default");
+    BOOST_CHECK_EQUAL(f1("id",grammar_categories_bitmask(grammar_ru::zhensky_rod)).text(),"first");
+    BOOST_CHECK_EQUAL(f1("id",grammar_categories_bitmask(grammar_ru::zhensky_rod,grammar_ru::datelny_padezh,grammar_ru::tvoritelny_padezh)).text(),"second");
+    BOOST_CHECK_EQUAL(f1("id",grammar_categories_bitmask(grammar_ru::zhensky_rod,grammar_ru::datelny_padezh)).text(),"first");
+}
+
+BOOST_AUTO_TEST_CASE(CheckReports)
+{
+    std::map<std::string,std::string> m1={{"field1","value1"}};
+    auto v=validator(
+        _["field1"](size(gte,100)),
+        _["field1"](empty(flag,true))
+    );
+
+    mapped_translator names(std::map<std::string,std::string>{{"field1","поле 1"}});
+
+    std::string rep1;
+    auto tr1=extend_translator(validator_translator_ru(),names);
+    v.apply(make_reporting_adapter(m1,make_reporter(rep1,make_formatter(tr1))));
+
+    std::string rep2;
+    frozen_translator frozen_names(names);
+    auto tr2=extend_translator(validator_frozen_translator_ru(),frozen_names);
+    v.apply(make_reporting_adapter(m1,make_reporter(rep2,make_formatter(tr2))));
+
+    BOOST_CHECK(!rep1.empty());
+    BOOST_CHECK_EQUAL(rep1,rep2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
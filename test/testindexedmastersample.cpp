@@ -0,0 +1,186 @@
+#include <map>
+#include <vector>
+#include <string>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace
+{
+
+struct IndexedSampleRecord
+{
+    int count() const noexcept
+    {
+        return _count;
+    }
+
+    int _count=0;
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(count)
+
+}
+
+BOOST_AUTO_TEST_SUITE(TestIndexedMasterSample)
+
+BOOST_AUTO_TEST_CASE(CheckIndexedSample)
+{
+    std::map<std::string,std::map<std::string,int>> sample{
+        {"field1",{{"subfield1",10},{"subfield2",20}}},
+        {"field2",{{"subfield1",30}}}
+    };
+    auto s=indexed_sample(sample);
+    static_assert(is_master_sample<decltype(s)>::value,"");
+    BOOST_CHECK_EQUAL(s.index_size(),0);
+
+    auto v1=validator(
+                _["field1"]["subfield1"](eq,s),
+                _["field1"]["subfield2"](gte,s),
+                _["field2"]["subfield1"](lt,s),
+                _["field2"]["subfield2"](eq,s)
+            );
+
+    std::map<std::string,std::map<std::string,int>> m1{
+        {"field1",{{"subfield1",10},{"subfield2",25}}},
+        {"field2",{{"subfield1",20},{"subfield2",1000}}}
+    };
+    BOOST_CHECK(v1.apply(m1));
+    BOOST_CHECK_EQUAL(s.index_size(),4);
+
+    // members are taken from index
+    BOOST_CHECK(v1.apply(m1));
+    BOOST_CHECK_EQUAL(s.index_size(),4);
+
+    m1["field1"]["subfield1"]=11;
+    BOOST_CHECK(!v1.apply(m1));
+    m1["field1"]["subfield1"]=10;
+    m1["field2"]["subfield1"]=30;
+    BOOST_CHECK(!v1.apply(m1));
+    m1["field2"]["subfield1"]=20;
+
+    // index must be cleared when sample is modified
+    sample["field2"]["subfield2"]=1;
+    s.clear_index();
+    BOOST_CHECK_EQUAL(s.index_size(),0);
+    BOOST_CHECK(!v1.apply(m1));
+    m1["field2"]["subfield2"]=1;
+    BOOST_CHECK(v1.apply(m1));
+
+    // indexed sample with description
+    auto v2=validator(
+                _["field1"]["subfield1"](eq,_(s,"golden template"))
+            );
+    BOOST_CHECK(v2.apply(m1));
+    m1["field1"]["subfield1"]=100;
+    std::string rep;
+    auto ra=make_reporting_adapter(m1,rep);
+    BOOST_CHECK(!v2.apply(ra));
+    BOOST_CHECK_EQUAL(rep,"subfield1 of field1 must be equal to subfield1 of field1 of golden template");
+}
+
+BOOST_AUTO_TEST_CASE(CheckIndexedSampleNotIndexedMembers)
+{
+    // members returned by value
+    IndexedSampleRecord sample1{10};
+    auto s1=indexed_sample(sample1);
+    auto v1=validator(
+                _[count](eq,s1)
+            );
+    IndexedSampleRecord r1{10};
+    BOOST_CHECK(v1.apply(r1));
+    BOOST_CHECK_EQUAL(s1.index_size(),1);
+    r1._count=20;
+    BOOST_CHECK(!v1.apply(r1));
+    sample1._count=20;
+    BOOST_CHECK(v1.apply(r1));
+
+    // members of element aggregations
+    std::vector<int> sample2{1,2,3};
+    auto s2=indexed_sample(sample2);
+    auto v2=validator(
+                _[ALL](gte,s2)
+            );
+    std::vector<int> vec1{1,2,3};
+    BOOST_CHECK(v2.apply(vec1));
+    BOOST_CHECK_EQUAL(s2.index_size(),0);
+
+    // sample does not have member
+    std::map<std::string,int> sample3{{"field1",1}};
+    auto s3=indexed_sample(sample3);
+    auto v3=validator(
+                _["field2"](eq,s3)
+            );
+    std::map<std::string,int> m3{{"field2",100}};
+    BOOST_CHECK(v3.apply(m3));
+    BOOST_CHECK_EQUAL(s3.index_size(),1);
+    BOOST_CHECK(v3.apply(m3));
+}
+
+BOOST_AUTO_TEST_CASE(CheckIndexedSampleManyMembers)
+{
+    const size_t count=200;
+    std::map<std::string,int> sample;
+    std::vector<std::string> keys;
+    for (size_t i=0;i<count;i++)
+    {
+        keys.push_back(std::to_string(i));
+        sample[keys.back()]=static_cast<int>(i);
+    }
+    auto s=indexed_sample(sample);
+    auto m=sample;
+
+    auto check=[&]()
+    {
+        bool ok=true;
+        for (const auto& key : keys)
+        {
+            auto v=validator(
+                        _[key](eq,s)
+                    );
+            ok=v.apply(m) && ok;
+        }
+        return ok;
+    };
+
+    std::vector<std::thread> threads;
+    std::vector<char> results(4,0);
+    for (size_t i=0;i<results.size();i++)
+    {
+        threads.emplace_back(
+            [&,i]()
+            {
+                results[i]=check() && check();
+            }
+        );
+    }
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+    for (auto&& result : results)
+    {
+        BOOST_CHECK(result);
+    }
+    BOOST_CHECK_EQUAL(s.index_size(),count);
+
+    // index can be cleared concurrently with validation
+    std::thread th(
+        [&]()
+        {
+            results[0]=check();
+        }
+    );
+    s.clear_index();
+    th.join();
+    BOOST_CHECK(results[0]);
+    BOOST_CHECK(check());
+    BOOST_CHECK_EQUAL(s.index_size(),count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,8 +1,17 @@
+#include <vector>
+#include <string>
+#include <locale>
+#include <limits>
+#include <algorithm>
+
 #include <boost/test/unit_test.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 
 #include <dracosha/validator/validator.hpp>
 #include <dracosha/validator/adapters/reporting_adapter.hpp>
 #include <dracosha/validator/operators/lexicographical.hpp>
+#include <dracosha/validator/operators/lex_in.hpp>
+#include <dracosha/validator/range.hpp>
 
 using namespace DRACOSHA_VALIDATOR_NAMESPACE;
 
@@ -209,4 +218,129 @@ BOOST_AUTO_TEST_CASE(CheckLexParts)
     rep.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckLexThreeWayCompare)
+{
+    // results of lexicographical operators must be the same as of boost::algorithm for ASCII and non-ASCII strings
+    std::vector<std::string> strs={"","a","A","ab","abc","abd","b","String","String1","String10","string1",std::string("a\0b",3),
+                                   "\xc3\xa9","a\xc3\xa9","a\xe0","\xe0","ab\x7f","ab\x80"};
+    size_t mismatches=0;
+    for (auto&& a:strs)
+    {
+        for (auto&& b:strs)
+        {
+            auto less=boost::algorithm::lexicographical_compare(a,b);
+            auto equal=boost::algorithm::equals(a,b);
+            if (lex_eq(a,b)!=equal
+                ||
+                lex_ne(a,b)==equal
+                ||
+                lex_lt(a,b)!=less
+                ||
+                lex_lte(a,b)!=(less||equal)
+                ||
+                lex_gt(a,b)!=!(less||equal)
+                ||
+                lex_gte(a,b)!=!less
+                ||
+                lex_lt(a.c_str(),b)!=boost::algorithm::lexicographical_compare(a.c_str(),b)
+               )
+            {
+                ++mismatches;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(mismatches,0);
+
+    // characters are compared as char the same way as in boost::algorithm
+    BOOST_CHECK_EQUAL(lex_lt(std::string("a"),std::string("\xe0")),boost::algorithm::lexicographical_compare(std::string("a"),std::string("\xe0")));
+    BOOST_CHECK_EQUAL(lex_gt(std::string("\xe0"),std::string("a")),boost::algorithm::lexicographical_compare(std::string("a"),std::string("\xe0")));
+
+    // ranges of other types
+    std::vector<int> v1{1,2,3};
+    std::vector<int> v2{1,2,4};
+    std::vector<int> v3{1,2};
+    BOOST_CHECK(lex_lt(v1,v2));
+    BOOST_CHECK(lex_lte(v1,v1));
+    BOOST_CHECK(lex_eq(v1,v1));
+    BOOST_CHECK(lex_gt(v1,v3));
+    BOOST_CHECK(lex_gte(v2,v1));
+    BOOST_CHECK(!lex_gt(v3,v1));
+
+    BOOST_CHECK(lex_in(std::string("String1"),interval("String","String10")));
+    BOOST_CHECK(!lex_in(std::string("String10"),interval("String","String10",interval.open())));
+    BOOST_CHECK(lex_in(std::string("String1"),interval(std::string("String"),std::string("String10"))));
+    BOOST_CHECK(ilex_in(std::string("STRING1"),interval(std::string("String"),std::string("String10"))));
+}
+
+BOOST_AUTO_TEST_CASE(CheckILexAsciiFastPath)
+{
+    // results of case insensitive operators must be the same as of boost::algorithm for ASCII and non-ASCII strings
+    std::vector<std::string> strs={
+        "",
+        "a",
+        "A",
+        "Hello",
+        "hELLO",
+        "Hello world",
+        "Header-Name: value of header that is longer than block",
+        "HEADER-NAME: VALUE OF HEADER THAT IS LONGER THAN BLOCK",
+        "header-name: value of header that is longer than blocK",
+        "header-name: value of header that is longer than block!",
+        "header-name: value of header that is longer",
+        "@[`{",
+        "`{@[",
+        "value of header",
+        "VALUE OF HEADER THAT",
+        "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 header that is longer than block",
+        "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 HEADER THAT IS LONGER THAN BLOCK",
+        "header that is longer than \xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82",
+        "\xff\x80" "abc"
+    };
+
+    size_t mismatches=0;
+    for (auto&& a:strs)
+    {
+        for (auto&& b:strs)
+        {
+            if (ilex_eq(a,b)!=boost::algorithm::iequals(a,b)
+                ||
+                ilex_lt(a,b)!=boost::algorithm::ilexicographical_compare(a,b)
+                ||
+                ilex_lte(a,b)!=(boost::algorithm::ilexicographical_compare(a,b) || boost::algorithm::iequals(a,b))
+                ||
+                ilex_contains(a,b)!=boost::algorithm::icontains(a,b)
+                ||
+                ilex_starts_with(a,b)!=boost::algorithm::istarts_with(a,b)
+                ||
+                ilex_ends_with(a,b)!=boost::algorithm::iends_with(a,b)
+               )
+            {
+                BOOST_TEST_MESSAGE("Mismatch of \"" << a << "\" and \"" << b << "\"");
+                ++mismatches;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(mismatches,0);
+
+    // non-ASCII characters are ordered as char by case sensitive and case insensitive operators
+    std::string e_acute="\xc3\xa9";
+    bool char_signed=std::numeric_limits<char>::is_signed;
+    BOOST_CHECK_EQUAL(lex_lt(e_acute,"a"),char_signed);
+    BOOST_CHECK_EQUAL(ilex_lt(e_acute,"a"),char_signed);
+    BOOST_CHECK_EQUAL(lex_gt(e_acute,"A"),!char_signed);
+    BOOST_CHECK_EQUAL(ilex_gt(e_acute,"A"),!char_signed);
+    BOOST_CHECK_EQUAL(ilex_lt(e_acute,"a"),boost::algorithm::ilexicographical_compare(e_acute,std::string("a")));
+
+    std::string header="Content-Type-Of-Very-Long-Header";
+    BOOST_CHECK(ilex_eq(header,"content-type-of-very-long-header"));
+    BOOST_CHECK(ilex_eq(header.c_str(),string_view("CONTENT-TYPE-OF-VERY-LONG-HEADER")));
+    BOOST_CHECK(!ilex_eq(header,"content-type-of-very-long-headeR!"));
+    BOOST_CHECK(ilex_contains(header,"VERY-long"));
+    BOOST_CHECK(ilex_in(header,range({"accept","CONTENT-TYPE-OF-VERY-LONG-HEADER"})));
+    BOOST_CHECK(ilex_in(header,range({"accept","CONTENT-TYPE-OF-VERY-LONG-HEADER"},sorted)));
+    BOOST_CHECK(ilex_nin(header,range({"accept","content-type"})));
+    BOOST_CHECK(ilex_in(header,range({"accept","CONTENT-TYPE-OF-VERY-LONG-HEADER"},hashed)));
+    BOOST_CHECK(ilex_nin(header,range({"accept","content-type"},hashed)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
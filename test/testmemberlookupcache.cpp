@@ -0,0 +1,143 @@
+#include <map>
+#include <vector>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/validate.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestMemberLookupCache)
+
+namespace {
+
+struct CountingObject
+{
+    const int& counter() const
+    {
+        ++count;
+        return value;
+    }
+
+    int value=10;
+    mutable size_t count=0;
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(counter)
+
+}
+
+BOOST_AUTO_TEST_CASE(CheckSiblingsResolvedOnce)
+{
+    auto v=validator(
+                _[counter](gte,0),
+                _[counter](lte,100),
+                _[counter](ne,50)
+            );
+
+    CountingObject obj;
+
+    // cache is disabled by default
+    BOOST_CHECK(v.apply(obj));
+    BOOST_CHECK_EQUAL(obj.count,3);
+
+    obj.count=0;
+    auto a0=make_default_adapter(obj);
+    BOOST_CHECK(!a0.traits().is_member_lookup_cache_enabled());
+    a0.traits().set_member_lookup_cache_enabled(true);
+    BOOST_CHECK(v.apply(a0));
+    BOOST_CHECK_EQUAL(obj.count,1);
+
+    // cache is cleared after validation
+    obj.count=0;
+    obj.value=50;
+    BOOST_CHECK(!v.apply(a0));
+    BOOST_CHECK_EQUAL(obj.count,1);
+
+    // nested aggregations share the cache
+    auto v1=validator(
+                _[counter](gte,0),
+                validator(
+                    _[counter](lte,100)
+                ) ^OR^ _[counter](eq,1000),
+                _[counter](gte,0) ^AND^ _[counter](ne,20)
+            );
+    obj.count=0;
+    obj.value=10;
+    BOOST_CHECK(v1.apply(a0));
+    BOOST_CHECK_EQUAL(obj.count,1);
+
+    // disabled cache
+    obj.count=0;
+    a0.traits().set_member_lookup_cache_enabled(false);
+    BOOST_CHECK(v.apply(a0));
+    BOOST_CHECK_EQUAL(obj.count,3);
+}
+
+BOOST_AUTO_TEST_CASE(CheckMapMembers)
+{
+    auto v1=validator(
+                _["field1"](gte,0),
+                _["field1"](lte,100),
+                _["field2"](exists,false)
+            );
+    std::map<std::string,int> m1{{"field1",10},{"field3",1}};
+    auto a1=make_default_adapter(m1);
+    a1.traits().set_member_lookup_cache_enabled(true);
+    a1.set_check_member_exists_before_validation(true);
+    BOOST_CHECK(v1.apply(a1));
+    m1["field1"]=200;
+    BOOST_CHECK(!v1.apply(a1));
+    m1["field1"]=1;
+    m1["field2"]=1;
+    BOOST_CHECK(!v1.apply(a1));
+
+    auto v2=validator(
+                _["field3"]["field4"](eq,1),
+                _["field3"]["field5"](exists,false),
+                _["field3"]["field4"](ne,0)
+            );
+    std::map<std::string,std::map<std::string,int>> m2{
+        {"field3",{{"field4",1}}}
+    };
+    auto a2=make_default_adapter(m2);
+    a2.traits().set_member_lookup_cache_enabled(true);
+    a2.set_check_member_exists_before_validation(true);
+    BOOST_CHECK(v2.apply(a2));
+
+    // cached references must not survive modifications of object between validations
+    m2["field3"].erase("field4");
+    BOOST_CHECK(v2.apply(a2));
+    a2.set_unknown_member_mode(if_member_not_found::abort);
+    BOOST_CHECK(!v2.apply(a2));
+    m2["field3"]["field4"]=1;
+    BOOST_CHECK(v2.apply(a2));
+    m2["field3"]["field4"]=2;
+    BOOST_CHECK(!v2.apply(a2));
+}
+
+BOOST_AUTO_TEST_CASE(CheckAggregations)
+{
+    auto v=validator(
+                _["field1"][ALL](gte,0),
+                _["field1"][ANY](eq,5),
+                _["field1"](size(gte,2)),
+                _["field1"][1](eq,5)
+            );
+
+    std::map<std::string,std::vector<int>> m1{{"field1",{1,5,10}}};
+    auto a1=make_default_adapter(m1);
+    a1.traits().set_member_lookup_cache_enabled(true);
+    BOOST_CHECK(v.apply(a1));
+    m1["field1"][1]=6;
+    BOOST_CHECK(!v.apply(a1));
+
+    std::string rep;
+    BOOST_CHECK(!v.apply(make_reporting_adapter(m1,rep)));
+    BOOST_CHECK_EQUAL(rep,"at least one element of field1 must be equal to 5");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
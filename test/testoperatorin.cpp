@@ -406,4 +406,166 @@ BOOST_AUTO_TEST_CASE(CheckInRangeReport)
     rep.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckInHashedRange)
+{
+    size_t val=90;
+    auto a1=make_default_adapter(val);
+
+    auto v1=validator(in,range({70,80,90,100},hashed));
+    BOOST_CHECK(v1.apply(a1));
+
+    auto v2=validator(in,range({70,80},hashed));
+    BOOST_CHECK(!v2.apply(a1));
+
+    std::vector<size_t> vec3{70,80,90,100};
+    auto v3=validator(in,range(vec3,hashed));
+    BOOST_CHECK(v3.apply(a1));
+
+    std::vector<size_t> vec4{70,80};
+    auto v4=validator(in,range(vec4,hashed));
+    BOOST_CHECK(!v4.apply(a1));
+
+    auto v5=validator(nin,range({70,80,90,100},hashed));
+    BOOST_CHECK(!v5.apply(a1));
+
+    auto v6=validator(nin,range(vec4,hashed));
+    BOOST_CHECK(v6.apply(a1));
+
+    std::vector<int> vec7;
+    for (int i=0;i<20000;i+=2)
+    {
+        vec7.push_back(-i);
+    }
+    auto v7=validator(in,range(vec7,hashed));
+    for (int i=-20010;i<10;i++)
+    {
+        BOOST_CHECK_EQUAL(v7.apply(i),i<=0 && i>-20000 && i%2==0);
+    }
+    // results for values of other integral types must be the same as for unhashed range
+    auto v7_1=validator(in,range(vec7));
+    int64_t i64=-100;
+    BOOST_CHECK(v7.apply(i64));
+    unsigned int u32=static_cast<unsigned int>(-100);
+    BOOST_CHECK_EQUAL(v7.apply(u32),v7_1.apply(u32));
+    uint64_t u64=static_cast<uint64_t>(-100);
+    BOOST_CHECK_EQUAL(v7.apply(u64),v7_1.apply(u64));
+    short i16=-100;
+    BOOST_CHECK(v7.apply(i16));
+
+    std::vector<uint64_t> vec7_2{static_cast<uint64_t>(-100),100};
+    auto v7_2=validator(in,range(vec7_2,hashed));
+    auto v7_3=validator(in,range(vec7_2));
+    BOOST_CHECK_EQUAL(v7_2.apply(-100),v7_3.apply(-100));
+    BOOST_CHECK_EQUAL(v7_2.apply(i64),v7_3.apply(i64));
+    BOOST_CHECK_EQUAL(v7_2.apply(i16),v7_3.apply(i16));
+    BOOST_CHECK(v7_2.apply(100));
+
+    // copies share the same index
+    auto v8=v7;
+    BOOST_CHECK(v8.apply(-100));
+    BOOST_CHECK(!v8.apply(-101));
+
+    auto v9=validator(in,range({1.5,2.5},hashed));
+    BOOST_CHECK(v9.apply(2.5));
+    BOOST_CHECK(!v9.apply(3.5));
+    BOOST_CHECK(v9.apply(2.5f));
+
+    std::vector<std::pair<int,int>> vec10{{1,2},{3,4}};
+    auto v10=validator(in,range(vec10,hashed));
+    BOOST_CHECK(v10.apply(std::make_pair(3,4)));
+    BOOST_CHECK(!v10.apply(std::make_pair(3,5)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckLexInHashedRange)
+{
+    std::string val("hello");
+    auto a1=make_default_adapter(val);
+
+    auto v1=validator(lex_in,range({"one","two","hello","three"},hashed));
+    BOOST_CHECK(v1.apply(a1));
+
+    auto v2=validator(lex_in,range({"HELLO","one","two"},hashed));
+    BOOST_CHECK(!v2.apply(a1));
+
+    std::vector<std::string> vec3{"one","two","hello","three"};
+    auto v3=validator(lex_in,range(vec3,hashed));
+    BOOST_CHECK(v3.apply(a1));
+
+    std::vector<std::string> vec4{"HELLO","one","two"};
+    auto v4=validator(lex_in,range(vec4,hashed));
+    BOOST_CHECK(!v4.apply(a1));
+
+    auto v5=validator(ilex_in,range({"HELLO","one","two"},hashed));
+    BOOST_CHECK(v5.apply(a1));
+
+    auto v6=validator(ilex_in,range(vec4,hashed));
+    BOOST_CHECK(v6.apply(a1));
+
+    auto v7=validator(ilex_in,range({"one","two"},hashed));
+    BOOST_CHECK(!v7.apply(a1));
+
+    auto v8=validator(ilex_nin,range(vec4,hashed));
+    BOOST_CHECK(!v8.apply(a1));
+
+    auto v9=validator(lex_nin,range(vec4,hashed));
+    BOOST_CHECK(v9.apply(a1));
+
+    auto v10=validator(in,range(vec3,hashed));
+    BOOST_CHECK(v10.apply(a1));
+    BOOST_CHECK(v10.apply("three"));
+    BOOST_CHECK(!v10.apply("four"));
+
+    std::vector<std::string> vec11;
+    for (size_t i=0;i<10000;i++)
+    {
+        vec11.push_back(std::string("Id")+std::to_string(i));
+    }
+    auto v11=validator(lex_in,range(vec11,hashed));
+    auto v12=validator(ilex_in,range(vec11,hashed));
+    BOOST_CHECK(v11.apply(std::string("Id9999")));
+    BOOST_CHECK(!v11.apply(std::string("ID9999")));
+    BOOST_CHECK(v12.apply(std::string("ID9999")));
+    BOOST_CHECK(v12.apply(std::string("id0")));
+    BOOST_CHECK(!v12.apply(std::string("id10000")));
+}
+
+BOOST_AUTO_TEST_CASE(CheckInHashedRangeReport)
+{
+    std::string rep;
+    size_t val=90;
+    auto a1=make_reporting_adapter(val,rep);
+
+    auto v1=validator(in,range({70,80,90,100},hashed));
+    BOOST_CHECK(v1.apply(a1));
+
+    auto v2=validator(in,range({70,80,100,1000},hashed));
+    BOOST_CHECK(!v2.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be in range [70, 80, 100, 1000]");
+    rep.clear();
+
+    std::vector<size_t> vec3{70,80,90,100};
+    auto v3=validator(nin,range(vec3,hashed));
+    BOOST_CHECK(!v3.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be not in range [70, 80, 90, 100]");
+    rep.clear();
+
+    auto v4=validator(in,range({70,80,100,1000,10000},hashed,3));
+    BOOST_CHECK(!v4.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be in range [70, 80, 100, ... ]");
+    rep.clear();
+
+    std::vector<size_t> vec5{70,80,100,1000,10000};
+    auto v5=validator(in,range(vec5,hashed,3));
+    BOOST_CHECK(!v5.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be in range [70, 80, 100, ... ]");
+    rep.clear();
+
+    std::string str("hello");
+    auto a2=make_reporting_adapter(str,rep);
+    auto v6=validator(ilex_in,range({"one","two","three"},hashed,2));
+    BOOST_CHECK(!v6.apply(a2));
+    BOOST_CHECK_EQUAL(rep,"must be in range [one, two, ... ]");
+    rep.clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+#include <vector>
+#include <map>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/lazy.hpp>
+#include <dracosha/validator/adapters/parallel_adapter.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestParallel)
+
+BOOST_AUTO_TEST_CASE(CheckParallelAll)
+{
+    thread_pool pool(4);
+
+    std::vector<int> v1(100000,10);
+    auto v=validator(
+                _[ALL](gte,0)
+            );
+
+    BOOST_CHECK(v.apply(v1));
+    BOOST_CHECK(v.apply(make_parallel_adapter(v1,pool,100)));
+
+    v1[77777]=-1;
+    BOOST_CHECK(!v.apply(v1));
+    BOOST_CHECK(!v.apply(make_parallel_adapter(v1,pool,100)));
+
+    v1[77777]=10;
+    v1[0]=-1;
+    BOOST_CHECK(!v.apply(make_parallel_adapter(v1,pool,100)));
+
+    v1[0]=10;
+    v1.back()=-1;
+    BOOST_CHECK(!v.apply(make_parallel_adapter(v1,pool,100)));
+
+    std::vector<int> empty;
+    BOOST_CHECK(v.apply(make_parallel_adapter(empty,pool,100)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelAny)
+{
+    thread_pool pool(4);
+
+    std::vector<int> v1(100000,10);
+    auto v=validator(
+                _[ANY](eq,100)
+            );
+
+    BOOST_CHECK(!v.apply(v1));
+    BOOST_CHECK(!v.apply(make_parallel_adapter(v1,pool,100)));
+
+    v1[55555]=100;
+    BOOST_CHECK(v.apply(v1));
+    BOOST_CHECK(v.apply(make_parallel_adapter(v1,pool,100)));
+
+    v1[55555]=10;
+    v1.back()=100;
+    BOOST_CHECK(v.apply(make_parallel_adapter(v1,pool,100)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelMember)
+{
+    thread_pool pool(2);
+
+    std::map<std::string,std::vector<std::vector<int>>> m1{
+        {"items",std::vector<std::vector<int>>(1000,std::vector<int>(50,5))}
+    };
+    auto v=validator(
+                _["items"][ALL][ALL](lt,10)
+            );
+    BOOST_CHECK(v.apply(make_parallel_adapter(m1,pool,10)));
+
+    m1["items"][999][49]=10;
+    BOOST_CHECK(!v.apply(make_parallel_adapter(m1,pool,10)));
+
+    auto v2=validator(
+                _["items"][ANY](size(gte,50))
+            );
+    BOOST_CHECK(v2.apply(make_parallel_adapter(m1,pool,10)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelNotRandomAccess)
+{
+    thread_pool pool(2);
+
+    std::map<int,int> m1;
+    for (int i=0;i<1000;i++)
+    {
+        m1[i]=i;
+    }
+    auto v=validator(
+                _[ALL](gte,0)
+            );
+    BOOST_CHECK(v.apply(make_parallel_adapter(m1,pool,10)));
+    m1[500]=-1;
+    BOOST_CHECK(!v.apply(make_parallel_adapter(m1,pool,10)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelCancel)
+{
+    thread_pool pool(4);
+
+    std::atomic<size_t> count{0};
+    auto limit=[&count]()
+    {
+        ++count;
+        return 0;
+    };
+
+    std::vector<int> v1(1000000,10);
+    v1[0]=-1;
+    auto v=validator(
+                _[ALL](gte,lazy(limit))
+            );
+    BOOST_CHECK(!v.apply(make_parallel_adapter(v1,pool,1000)));
+    BOOST_CHECK(count<v1.size());
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelWorkers)
+{
+    thread_pool pool(2);
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    size_t in_workers=0;
+    bool wait_workers=false;
+    auto limit=[&]()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (thread_pool::is_worker_thread())
+        {
+            ++in_workers;
+            cond.notify_all();
+        }
+        else if (wait_workers)
+        {
+            // block the caller until a worker picks up a chunk, so the result does not depend on timing
+            cond.wait(lock,[&in_workers](){return in_workers>0;});
+        }
+        return 0;
+    };
+    auto workers_count=[&]()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return in_workers;
+    };
+
+    std::vector<int> v1(10000,10);
+    auto v=validator(
+                _[ALL](gte,lazy(limit))
+            );
+    BOOST_CHECK(v.apply(v1));
+    BOOST_CHECK_EQUAL(workers_count(),0u);
+
+    BOOST_CHECK(v.apply(make_parallel_adapter(v1,pool,v1.size())));
+    BOOST_CHECK_EQUAL(workers_count(),0u);
+
+    wait_workers=true;
+    BOOST_CHECK(v.apply(make_parallel_adapter(v1,pool,10)));
+    BOOST_CHECK(workers_count()>0u);
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelException)
+{
+    thread_pool pool(4);
+
+    std::vector<int> v1(10000,10);
+    auto throwing=[]() -> int
+    {
+        throw std::runtime_error("failed");
+    };
+    auto v2=validator(
+                _[ALL](gte,lazy(throwing))
+            );
+    BOOST_CHECK_THROW(v2.apply(make_parallel_adapter(v1,pool,100)),std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
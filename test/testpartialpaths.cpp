@@ -5,6 +5,7 @@
 #include <dracosha/validator/adapters/reporting_adapter.hpp>
 
 #include <dracosha/validator/filter_path.hpp>
+#include <dracosha/validator/path_trie.hpp>
 
 using namespace DRACOSHA_VALIDATOR_NAMESPACE;
 
@@ -189,4 +190,78 @@ BOOST_AUTO_TEST_CASE(CheckNestedPaths)
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(CheckPathTrie)
+{
+    auto v1=validator(
+        _["level1"]["field1"](exists,true),
+        _["level1"]["field2"](exists,true),
+        _["level2"]["field3"](exists,true)
+    );
+
+    std::map<std::string,std::set<std::string>> m1{
+        {"level1",{"field1","field2"}},
+        {"level2",{"field4"}},
+    };
+    auto a1=make_default_adapter(m1);
+    BOOST_CHECK(!v1.apply(a1));
+
+    auto a2=include_paths(a1,path_trie(member_path_list(_["level1"])));
+    BOOST_CHECK(v1.apply(a2));
+    auto a3=include_paths(a1,make_path_trie(_["level2"]["field3"]));
+    BOOST_CHECK(!v1.apply(a3));
+    auto a4=exclude_paths(a1,make_path_trie(_["level2"]));
+    BOOST_CHECK(v1.apply(a4));
+    auto a5=exclude_paths(a1,make_path_trie(_["level2"]["field4"]));
+    BOOST_CHECK(!v1.apply(a5));
+    auto a6=exclude_paths(a1,make_path_trie(_["level2"][ALL]));
+    BOOST_CHECK(v1.apply(a6));
+    auto a7=include_and_exclude_paths(a1,
+                make_path_trie(_["level1"],_["level2"]),
+                make_path_trie(_["level2"]["field3"])
+            );
+    BOOST_CHECK(v1.apply(a7));
+
+    // trie with a large number of paths
+    path_trie trie;
+    for (size_t i=0;i<10000;i++)
+    {
+        trie.add(_[std::string("field")+std::to_string(i)]);
+    }
+    trie.add(_["level1"]);
+    BOOST_CHECK_EQUAL(trie.size(),10001);
+    trie.add(_["level1"]);
+    BOOST_CHECK_EQUAL(trie.size(),10001);
+    auto a8=include_paths(a1,trie);
+    BOOST_CHECK(v1.apply(a8));
+
+    // copies of trie are not affected by modifications of the original trie
+    auto trie_copy=trie;
+    trie.add(_["level2"]);
+    BOOST_CHECK_EQUAL(trie.size(),10002);
+    BOOST_CHECK_EQUAL(trie_copy.size(),10001);
+    BOOST_CHECK(trie.has_prefix_of(member_path(_["level2"]["field3"])));
+    BOOST_CHECK(!trie_copy.has_prefix_of(member_path(_["level2"]["field3"])));
+    BOOST_CHECK(v1.apply(a8));
+    BOOST_CHECK(!v1.apply(include_paths(a1,trie)));
+    trie_copy.add(_["level3"]);
+    BOOST_CHECK(trie_copy.has_prefix_of(member_path(_["level3"]["field1"])));
+    BOOST_CHECK(!trie.has_prefix_of(member_path(_["level3"]["field1"])));
+    BOOST_CHECK(trie_copy.has_prefix_of(member_path(_["field9999"])));
+
+    // integral keys of different types
+    auto v2=validator(
+        _[10](gte,100),
+        _[20](gte,100)
+    );
+    std::map<size_t,size_t> m2{{10,50},{20,200}};
+    auto a9=make_default_adapter(m2);
+    BOOST_CHECK(!v2.apply(a9));
+    BOOST_CHECK(v2.apply(exclude_paths(a9,make_path_trie(_[size_t(10)]))));
+    BOOST_CHECK(!v2.apply(exclude_paths(a9,make_path_trie(_[11]))));
+
+    BOOST_CHECK(trie.has_prefix_of(member_path(_["level1"]["field1"])));
+    BOOST_CHECK(!trie.has_prefix_of(member_path(_["level3"]["field1"])));
+    BOOST_CHECK(!trie.has_prefix_of(member_path(_[1])));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,8 @@
 #include <dracosha/validator/validator.hpp>
 #include <dracosha/validator/adapters/prevalidation_adapter.hpp>
 #include <dracosha/validator/prevalidation/set_validated.hpp>
+#include <dracosha/validator/prevalidation/resize_validated.hpp>
+#include <dracosha/validator/prevalidation/clear_validated.hpp>
 
 namespace hana=boost::hana;
 
@@ -575,6 +577,50 @@ BOOST_AUTO_TEST_CASE(CheckUpdateValidatedWithSample)
     BOOST_CHECK_EQUAL(m7["field3"][0],"zzzzz");
 }
 
+BOOST_AUTO_TEST_CASE(CheckResizeClearOrNotPrevalidation)
+{
+    error_report err;
+    std::map<std::string,std::string> m1{
+        {"field1","value1"}
+    };
+
+    // implications of resize are combined in OR aggregation
+    auto v1=validator(
+                _["field1"](size(gte,5) ^OR^ empty(flag,true))
+            );
+    resize_validated(m1,_["field1"],6,v1,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1["field1"].size(),6);
+    resize_validated(m1,_["field1"],4,v1,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(m1["field1"].size(),6);
+
+    // implications of resize are combined in NOT aggregation
+    auto v2=validator(
+                _["field1"](NOT(size(eq,3)))
+            );
+    resize_validated(m1,_["field1"],4,v2,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1["field1"].size(),4);
+    resize_validated(m1,_["field1"],3,v2,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(m1["field1"].size(),4);
+
+    // implications of clear are combined in OR aggregation
+    auto v3=validator(
+                _["field1"](size(eq,1) ^OR^ empty(flag,false))
+            );
+    clear_validated(m1,_["field1"],v3,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(m1["field1"].size(),4);
+    auto v4=validator(
+                _["field1"](size(eq,0) ^OR^ empty(flag,false))
+            );
+    clear_validated(m1,_["field1"],v4,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK(m1["field1"].empty());
+}
+
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
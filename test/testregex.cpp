@@ -214,4 +214,58 @@ BOOST_AUTO_TEST_CASE(CheckHex)
     rep.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckRegexCache)
+{
+    auto& cache=regex_cache::instance();
+    cache.clear();
+
+    auto v1=validator(
+        regex_match,"[0-9]+"
+    );
+    auto v2=validator(
+        regex_contains,std::string("[0-9]+")
+    );
+
+    BOOST_CHECK(v1.apply(std::string("12345")));
+    BOOST_CHECK_EQUAL(cache.misses(),1u);
+    BOOST_CHECK_EQUAL(cache.hits(),0u);
+
+    BOOST_CHECK(!v1.apply(std::string("123a45")));
+    BOOST_CHECK(v2.apply(std::string("123a45")));
+    BOOST_CHECK(!v2.apply(std::string("abc")));
+    BOOST_CHECK_EQUAL(cache.misses(),1u);
+    BOOST_CHECK_EQUAL(cache.hits(),3u);
+    BOOST_CHECK_EQUAL(cache.size(),1u);
+
+    auto rx1=cache.get("[a-z]+");
+    auto rx2=cache.get("[a-z]+",std::regex_constants::ECMAScript|std::regex_constants::icase);
+    BOOST_CHECK(rx1!=rx2);
+    BOOST_CHECK(rx1==cache.get("[a-z]+"));
+    BOOST_CHECK(std::regex_match("ABC",*rx2));
+    BOOST_CHECK(!std::regex_match("ABC",*rx1));
+    BOOST_CHECK_EQUAL(cache.size(),3u);
+
+    cache.set_capacity(2);
+    BOOST_CHECK_EQUAL(cache.size(),2u);
+    cache.get("[A-Z]+");
+    BOOST_CHECK_EQUAL(cache.size(),2u);
+    BOOST_CHECK_EQUAL(cache.capacity(),2u);
+
+    BOOST_CHECK_THROW(cache.get("[a-z"),std::regex_error);
+    BOOST_CHECK_EQUAL(cache.size(),2u);
+
+    // least recently used expression is evicted
+    cache.clear();
+    auto rx3=cache.get("a+");
+    auto rx4=cache.get("b+");
+    BOOST_CHECK(rx3==cache.get("a+"));
+    cache.get("c+");
+    BOOST_CHECK_EQUAL(cache.size(),2u);
+    BOOST_CHECK(rx3==cache.get("a+"));
+    BOOST_CHECK(rx4!=cache.get("b+"));
+
+    cache.set_capacity(regex_cache::default_capacity);
+    cache.clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,9 +3,31 @@
 #include <dracosha/validator/validator.hpp>
 #include <dracosha/validator/reporting/reporter.hpp>
 #include <dracosha/validator/reporting/reporter_with_object_name.hpp>
+#include <dracosha/validator/adapters/reporting_adapter.hpp>
 
 using namespace DRACOSHA_VALIDATOR_NAMESPACE;
 
+namespace {
+
+using default_formatter_type=std::decay_t<decltype(get_default_formatter())>;
+
+struct counting_formatter : public default_formatter_type
+{
+    counting_formatter() : default_formatter_type(get_default_formatter())
+    {}
+
+    template <typename MemberT>
+    std::string member_to_string(const MemberT& member) const
+    {
+        ++count;
+        return default_formatter_type::member_to_string(member);
+    }
+
+    mutable size_t count=0;
+};
+
+}
+
 BOOST_AUTO_TEST_SUITE(TestReporter)
 
 BOOST_AUTO_TEST_CASE(CheckReporter)
@@ -106,4 +128,52 @@ BOOST_AUTO_TEST_CASE(CheckReporterWithObjectName)
     rep1.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckLazyAggregationMember)
+{
+    std::string rep1;
+    counting_formatter f1;
+    auto r1=make_reporter(rep1,f1);
+
+    // names of members are not formatted for successful aggregations
+    auto m1=_["field1"];
+    r1.aggregate_open(string_and,m1);
+    r1.aggregate_close(true);
+    BOOST_CHECK_EQUAL(f1.count,0);
+    BOOST_CHECK(rep1.empty());
+
+    auto p1=hana::make_tuple(std::string("field1"));
+    r1.aggregate_open_path(string_or,p1);
+    r1.aggregate_close(true);
+    BOOST_CHECK_EQUAL(f1.count,0);
+
+    r1.aggregate_open(string_and,m1);
+    r1.validate(m1,value,gte,10);
+    r1.aggregate_close(false);
+    BOOST_CHECK_EQUAL(f1.count,1);
+    BOOST_CHECK_EQUAL(rep1,std::string("field1 must be greater than or equal to 10"));
+    rep1.clear();
+
+    // names of temporary members are formatted immediately
+    f1.count=0;
+    r1.aggregate_open(string_and,_["field1"]);
+    BOOST_CHECK_EQUAL(f1.count,1);
+    r1.aggregate_close(true);
+
+    // validation with reporting adapter
+    std::map<std::string,std::vector<size_t>> m2={{"field1",{1,2,3}}};
+    auto v=validator(
+        _["field1"](size(gte,1) ^AND^ size(lt,10)),
+        _["field1"][ALL](gte,1)
+    );
+    f1.count=0;
+    BOOST_CHECK(v.apply(make_reporting_adapter(m2,make_reporter(rep1,f1))));
+    BOOST_CHECK_EQUAL(f1.count,0);
+    BOOST_CHECK(rep1.empty());
+
+    m2["field1"].push_back(0);
+    BOOST_CHECK(!v.apply(make_reporting_adapter(m2,make_reporter(rep1,f1))));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be greater than or equal to 1"));
+    BOOST_CHECK_EQUAL(f1.count,1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -254,4 +254,62 @@ BOOST_AUTO_TEST_CASE(CheckResizeValidated)
     check_contains_size(v8);
 }
 
+BOOST_AUTO_TEST_CASE(CheckResizeValidatedSinglePass)
+{
+    error_report err;
+    auto v1=validator(
+                _["field1"](size(lte,8)),
+                _["field1"](empty(flag,false)),
+                _["field1"](lex_starts_with,"value"),
+                _["field2"](length(gte,2)),
+                _["field3"](value(ne,"Invalid value"))
+            );
+    std::map<std::string,std::string> m1{
+        {"field1","value1"},
+        {"field2","value2"},
+        {"field3","value3"}
+    };
+
+    // each implication of resize is checked in the same pass
+    resize_validated(m1,_["field1"],10,v1,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("size of field1 must be less than or equal to 8"));
+    resize_validated(m1,_["field1"],0,v1,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be not empty"));
+    resize_validated(m1,_["field1"],3,v1,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must start with value"));
+    BOOST_CHECK_EQUAL(m1.find("field1")->second.size(),6);
+    resize_validated(m1,_["field1"],7,v1,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1.find("field1")->second.size(),7);
+
+    // other members are not affected
+    resize_validated(m1,_["field3"],0,v1,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK(m1.find("field3")->second.empty());
+
+    // implications can be validated explicitly
+    validate_implications(
+        hana::make_tuple(
+            make_prevalidation_implication(_["field2"][size],1),
+            make_prevalidation_implication(_["field2"][empty],false)
+        ),
+        v1,
+        err
+    );
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("length of field2 must be greater than or equal to 2"));
+    validate_implications(
+        hana::make_tuple(
+            make_prevalidation_implication(_["field2"][size],2),
+            make_prevalidation_implication(_["field2"][empty],false)
+        ),
+        v1,
+        err
+    );
+    BOOST_CHECK(!err);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,7 @@
 
 #include <dracosha/validator/validator.hpp>
 #include <dracosha/validator/prevalidation/set_validated.hpp>
+#include <dracosha/validator/prevalidation/set_validated_batch.hpp>
 
 namespace hana=boost::hana;
 
@@ -206,4 +207,144 @@ BOOST_AUTO_TEST_CASE(CheckSetValidatedEmpty)
     BOOST_CHECK(!err);
 }
 
+BOOST_AUTO_TEST_CASE(CheckSetValidatedBatch)
+{
+    auto v=validator(
+        _["field1"](gte,100),
+        _["field2"](lt,1000),
+        _["level1"]["field3"](eq,10)
+    );
+
+    error_report err;
+
+    std::map<std::string,size_t> m1{{"field1",200},{"field2",300},{"field3",400}};
+
+    // edits of different types in a tuple
+    set_validated_batch(m1,hana::make_tuple(make_member_edit(_["field1"],500),make_member_edit(_["field2"],600)),v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1["field1"],500);
+    BOOST_CHECK_EQUAL(m1["field2"],600);
+
+    // nothing is set if at least one edit fails
+    set_validated_batch(m1,hana::make_tuple(make_member_edit(_["field1"],700),make_member_edit(_["field2"],2000)),v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"field2 must be less than 1000");
+    BOOST_CHECK_EQUAL(m1["field1"],500);
+    BOOST_CHECK_EQUAL(m1["field2"],600);
+    BOOST_CHECK_THROW(set_validated_batch(m1,hana::make_tuple(make_member_edit(_["field1"],50)),v),validation_error);
+    BOOST_CHECK_EQUAL(m1["field1"],500);
+
+    // edits known at runtime
+    std::vector<decltype(make_member_edit(_[std::string()],size_t()))> edits;
+    edits.push_back(make_member_edit(_[std::string("field1")],size_t(150)));
+    edits.push_back(make_member_edit(_[std::string("field2")],size_t(250)));
+    edits.push_back(make_member_edit(_[std::string("field3")],size_t(5000)));
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1["field1"],150);
+    BOOST_CHECK_EQUAL(m1["field2"],250);
+    BOOST_CHECK_EQUAL(m1["field3"],5000);
+
+    edits[1].value=1000;
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"field2 must be less than 1000");
+    BOOST_CHECK_EQUAL(m1["field2"],250);
+
+    edits.clear();
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(!err);
+
+    // nested members
+    std::map<std::string,std::map<std::string,size_t>> m2{{"level1",{{"field3",10}}}};
+    set_validated_batch(m2,hana::make_tuple(make_member_edit(_["level1"]["field3"],20)),v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"field3 of level1 must be equal to 10");
+    BOOST_CHECK_EQUAL(m2["level1"]["field3"],10);
+}
+
+BOOST_AUTO_TEST_CASE(CheckSetValidatedBatchIndexed)
+{
+    auto v=validator(
+        _["field10"](gte,100),
+        _["field20"](lt,1000),
+        _["field30"](lt,1000),
+        _["field40"](lt,1000),
+        _["field50"](lt,1000),
+        _["field60"](lt,1000),
+        _["field70"](lt,1000),
+        _["field80"](lt,1000),
+        _["field90"](lt,1000),
+        _["level1"]["field3"](eq,10)
+    );
+
+    error_report err;
+
+    std::map<std::string,size_t> m1;
+    using edit_type=decltype(make_member_edit(_[std::string()],size_t()));
+    std::vector<edit_type> edits;
+    for (size_t i=0;i<100;i++)
+    {
+        auto key=std::string("field")+std::to_string(i);
+        m1[key]=i;
+        edits.push_back(make_member_edit(_[std::move(key)],i+500));
+    }
+
+    // only edits of checked members are validated by each check
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1["field10"],510);
+    BOOST_CHECK_EQUAL(m1["field99"],599);
+
+    edits[20].value=1000;
+    edits[10].value=50;
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"field10 must be greater than or equal to 100");
+    BOOST_CHECK_EQUAL(m1["field10"],510);
+    BOOST_CHECK_EQUAL(m1["field20"],520);
+
+    edits[10].value=100;
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"field20 must be less than 1000");
+    BOOST_CHECK_EQUAL(m1["field10"],510);
+
+    // members checked after the index is built
+    edits[20].value=520;
+    edits[90].value=1000;
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"field90 must be less than 1000");
+    BOOST_CHECK_EQUAL(m1["field90"],590);
+    edits[90].value=999;
+    set_validated_batch(m1,edits,v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m1["field10"],100);
+    BOOST_CHECK_EQUAL(m1["field90"],999);
+
+    // implications of properties are matched with their members
+    auto v2=validator(
+        _["field31"](size(lte,3)),
+        _["field32"](size(lte,3)),
+        _["field33"](size(lte,3)),
+        _["field34"](size(lte,3)),
+        _["field35"](size(lte,3)),
+        _["field36"](size(lte,3)),
+        _["field37"](size(lte,3)),
+        _["field38"](size(lte,3)),
+        _["field30"](size(lte,3))
+    );
+    using implication_type=decltype(make_prevalidation_implication(_[std::string()][size],size_t()));
+    std::vector<implication_type> implications;
+    implications.push_back(make_prevalidation_implication(_[std::string("field1")][size],size_t(10)));
+    implications.push_back(make_prevalidation_implication(_[std::string("field30")][size],size_t(2)));
+    validate_implications(implications,v2,err);
+    BOOST_CHECK(!err);
+    implications.push_back(make_prevalidation_implication(_[std::string("field30")][size],size_t(4)));
+    validate_implications(implications,v2,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),"size of field30 must be less than or equal to 3");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -74,4 +74,42 @@ BOOST_AUTO_TEST_CASE(CheckStdFormatterWithRvals)
     checkFormatterWithRvals(make_backend_formatter);
 }
 
+BOOST_AUTO_TEST_CASE(CheckStdAppendMixed)
+{
+    std::string dst{"prefix"};
+    auto f=make_backend_formatter(dst);
+    f.append(std::string(" a"),' ',"b ",10,' ',1.5,' ',true,' ',string_view("c"));
+    BOOST_CHECK_EQUAL(dst,"prefix a b 10 1.5 1 c");
+
+    dst.clear();
+    f.append_join_args(", ",1,"two",'3',4.25);
+    BOOST_CHECK_EQUAL(dst,"1, two, 3, 4.25");
+
+    dst.clear();
+    std::vector<std::string> parts{"one","two","three"};
+    f.append_join(" and ",parts);
+    BOOST_CHECK_EQUAL(dst,"one and two and three");
+    std::vector<int> nums{1,2,3};
+    f.append_join(',',nums);
+    BOOST_CHECK_EQUAL(dst,"one and two and three1,2,3");
+}
+
+BOOST_AUTO_TEST_CASE(CheckStdAppendLongReport)
+{
+    std::string dst;
+    auto f=make_backend_formatter(dst);
+    std::string expected;
+    for (size_t i=0;i<10000;i++)
+    {
+        if (i!=0)
+        {
+            f.append(", ");
+            expected+=", ";
+        }
+        f.append("element ",i," must be less than ",i+1);
+        expected+="element "+std::to_string(i)+" must be less than "+std::to_string(i+1);
+    }
+    BOOST_CHECK_EQUAL(dst,expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -344,6 +344,59 @@ BOOST_AUTO_TEST_CASE(CheckExplicitMemberName)
     BOOST_CHECK_EQUAL(str3,"size of nested field");
 }
 
+BOOST_AUTO_TEST_CASE(CheckCachedMemberNames)
+{
+    translator_env env;
+    auto mn=make_cached_member_names(make_translated_member_names(env.translator()),4);
+    const auto& cache=*mn.traits.names_cache;
+    BOOST_CHECK_EQUAL(cache.max_size(),4);
+    BOOST_CHECK_EQUAL(cache.size(),0);
+
+    auto member1=_["field1"]["field2"];
+    BOOST_CHECK_EQUAL(std::string(mn(member1)),"field2 of field1_translated");
+    BOOST_CHECK_EQUAL(cache.size(),1);
+    BOOST_CHECK_EQUAL(std::string(mn(member1)),"field2 of field1_translated");
+    BOOST_CHECK_EQUAL(cache.size(),1);
+
+    // runtime keys are parts of cache key
+    auto member2=_["field1"]["field3"];
+    static_assert(std::is_same<decltype(member1),decltype(member2)>::value,"");
+    BOOST_CHECK_EQUAL(std::string(mn(member2)),"field3 of field1_translated");
+    BOOST_CHECK_EQUAL(cache.size(),2);
+    BOOST_CHECK_EQUAL(std::string(mn(_["field1"][10])),"element #10 of field1_translated");
+    BOOST_CHECK_EQUAL(std::string(mn(_["field1"][11])),"element #11 of field1_translated");
+    BOOST_CHECK_EQUAL(cache.size(),4);
+
+    // copies of formatter share the cache
+    auto mn2=mn;
+    BOOST_CHECK_EQUAL(std::string(mn2(member2)),"field3 of field1_translated");
+    BOOST_CHECK_EQUAL(cache.size(),4);
+
+    // explicit names are not cached
+    BOOST_CHECK_EQUAL(std::string(mn(_["field1"]("member1 name"))),"member1 name");
+    BOOST_CHECK_EQUAL(cache.size(),4);
+
+    // cache is cleared when limit is reached
+    BOOST_CHECK_EQUAL(std::string(mn(_["field1"][size])),"size of field1_translated");
+    BOOST_CHECK_EQUAL(cache.size(),1);
+    BOOST_CHECK_EQUAL(std::string(mn(make_member_property(member1,value))),"value_translated of field2 of field1_translated");
+    BOOST_CHECK_EQUAL(std::string(mn(member1)),"field2 of field1_translated");
+
+    mn.traits.names_cache->clear();
+    BOOST_CHECK_EQUAL(cache.size(),0);
+
+    // cache can be disabled
+    auto mn3=make_cached_member_names(make_default_member_names(),0);
+    BOOST_CHECK_EQUAL(std::string(mn3(member1)),"field2 of field1");
+    BOOST_CHECK_EQUAL(mn3.traits.names_cache->size(),0);
+
+    // dotted member names
+    auto mn4=make_cached_member_names(make_member_names(dotted_member_names_traits_t{}));
+    BOOST_CHECK_EQUAL(std::string(mn4(member1)),"[field1].[field2]");
+    BOOST_CHECK_EQUAL(std::string(mn4(member1)),"[field1].[field2]");
+    BOOST_CHECK_EQUAL(mn4.traits.names_cache->size(),1);
+}
+
 BOOST_AUTO_TEST_CASE(CheckOperator)
 {
     auto op1=_(gte,"not less than");
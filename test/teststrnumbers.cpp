@@ -1,8 +1,13 @@
+#include <regex>
+#include <cstdlib>
+#include <functional>
+
 #include <boost/test/unit_test.hpp>
 
 #include <dracosha/validator/validator.hpp>
 #include <dracosha/validator/adapters/reporting_adapter.hpp>
 #include <dracosha/validator/operators/number_patterns.hpp>
+#include <dracosha/validator/operators/string_patterns.hpp>
 
 using namespace DRACOSHA_VALIDATOR_NAMESPACE;
 
@@ -120,4 +125,74 @@ BOOST_AUTO_TEST_CASE(CheckStrFloat)
     rep.clear();
 }
 
+namespace {
+
+bool strtol_is_integer(const std::string& s)
+{
+   if(s.empty() || ((!isdigit(s[0])) && (s[0] != '-') && (s[0] != '+'))) return false;
+
+   char * p;
+   strtol(s.c_str(), &p, 10);
+
+   return (*p == 0);
+}
+
+void check_same_as_regex(const std::string& str)
+{
+    static const std::regex alpha("[0-9a-zA-Z_]*");
+    static const std::regex hex("[0-9a-fA-F]+");
+    static const std::regex flt("[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?");
+
+    BOOST_CHECK_MESSAGE(str_alpha(str,true)==std::regex_match(str,alpha),"str_alpha "<<str);
+    BOOST_CHECK_MESSAGE(str_hex(str,true)==std::regex_match(str,hex),"str_hex "<<str);
+    BOOST_CHECK_MESSAGE(str_float(str,true)==std::regex_match(str,flt),"str_float "<<str);
+    BOOST_CHECK_MESSAGE(str_int(str,true)==strtol_is_integer(str),"str_int "<<str);
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(CheckPatternsSameAsRegex)
+{
+    // all short strings of characters that are significant for patterns
+    const std::string chars{'0','9','a','F','z','_','.','e','-','+','@','[','`','{','\xB0',' '};
+    std::string str;
+    std::function<void(size_t)> generate=[&](size_t depth)
+    {
+        check_same_as_regex(str);
+        if (depth==0)
+        {
+            return;
+        }
+        for (auto ch:chars)
+        {
+            str.push_back(ch);
+            generate(depth-1);
+            str.pop_back();
+        }
+    };
+    generate(3);
+
+    // long strings with a single unexpected character at each position
+    for (size_t len=1;len<80;len++)
+    {
+        for (auto base:{'1','c','Z'})
+        {
+            std::string str(len,base);
+            check_same_as_regex(str);
+            for (size_t i=0;i<len;i++)
+            {
+                for (auto ch:{'.','g','/',':','@','\xC1','\0'})
+                {
+                    auto tmp=str;
+                    tmp[i]=ch;
+                    check_same_as_regex(tmp);
+                }
+            }
+        }
+    }
+    check_same_as_regex("-12345678901234567890123456789012345678901234567890");
+    check_same_as_regex("+1234567890123456789012345678901234567890.1234567890e-1234567890");
+    check_same_as_regex(".1234567890123456789012345678901234567890e+1234567890123456789");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
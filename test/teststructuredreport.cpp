@@ -0,0 +1,198 @@
+#include <map>
+#include <vector>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/validate.hpp>
+#include <dracosha/validator/reporting/structured_report.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestStructuredReport)
+
+namespace {
+
+template <typename ObjectT, typename ValidatorT>
+void checkSameMessage(const ObjectT& obj, const ValidatorT& v)
+{
+    error_report err1;
+    validate(obj,v,err1);
+
+    structured_error_report err2;
+    validate(obj,v,err2);
+
+    BOOST_CHECK_EQUAL(bool(err1),bool(err2));
+    BOOST_CHECK_EQUAL(err1.message(),err2.message());
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(CheckMessages)
+{
+    std::map<std::string,size_t> m1={{"field1",10},{"field2",20},{"field3",30}};
+
+    checkSameMessage(m1,validator(_["field1"](gte,100)));
+    checkSameMessage(m1,validator(_["field1"](gte,1)));
+    checkSameMessage(m1,validator(_["field1"](gte,1),_["field2"](lt,5)));
+    checkSameMessage(m1,validator(_["field1"](gte,100) ^OR^ _["field2"](lt,5)));
+    checkSameMessage(m1,validator(_["field1"](gte,100) ^OR^ _["field2"](lt,50)));
+    checkSameMessage(m1,validator(_["field4"](exists,true)));
+    checkSameMessage(m1,validator(_["field1"](exists,false)));
+    checkSameMessage(m1,validator(NOT(_["field1"](eq,10))));
+    checkSameMessage(m1,validator(_["field1"](NOT(value(gte,1)))));
+    checkSameMessage(m1,validator(NOT(_["field1"](eq,10),_["field1"](gte,8))));
+    checkSameMessage(m1,validator(NOT(_["field1"](eq,10) ^OR^ _["field1"](gte,100))));
+    checkSameMessage(m1,validator(_["field1"](gt,_["field2"]),_["field2"](eq,_["field3"])));
+    checkSameMessage(m1,validator(_["field2"](gt,_["field3"]) ^OR^ _["field3"](eq,_["field1"])));
+
+    std::map<std::string,size_t> m2={{"field1",100},{"field2",200},{"field3",300}};
+    checkSameMessage(m1,validator(_["field1"](gte,_(m2)),_["field2"](eq,_(m2))));
+
+    checkSameMessage(m1,validator(
+                            _["field1"](gte,100),
+                            _["field2"](gte,100)
+                         ).hint("Explicit description"));
+    checkSameMessage(m1,validator(
+                            _["field1"](gte,1),
+                            _["field2"](value(gte,100)).hint("field2 is too small")
+                         ));
+
+    size_t val=10;
+    checkSameMessage(val,validator(gte,100));
+    checkSameMessage(val,validator(value(gte,100) ^OR^ value(lt,5)));
+
+    std::string str="hello";
+    checkSameMessage(str,validator(size(gte,100)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckAggregationMessages)
+{
+    std::map<std::string,std::vector<size_t>> m1={{"field1",{1,2,3,4,5}}};
+
+    checkSameMessage(m1,validator(_["field1"][ALL](gte,3)));
+    checkSameMessage(m1,validator(_["field1"][ANY](gte,10)));
+    checkSameMessage(m1,validator(_["field1"][ANY](gte,3)));
+    checkSameMessage(m1,validator(_["field1"][ALL](gte,1) ^AND^ _["field1"][ANY](eq,100)));
+    checkSameMessage(m1,validator(_["field1"][ALL](value(gte,3) ^OR^ value(eq,1))));
+    checkSameMessage(m1,validator(NOT(_["field1"][ANY](gte,3))));
+    checkSameMessage(m1,validator(_["field1"][1](gte,10)));
+
+    std::map<std::string,std::map<std::string,size_t>> m2={
+        {"field1",{{"a",1},{"b",2}}},
+        {"field2",{{"a",10},{"b",20}}}
+    };
+    checkSameMessage(m2,validator(_[ALL][ALL](gte,5)));
+    checkSameMessage(m2,validator(_[ANY][ANY](gte,50)));
+    checkSameMessage(m2,validator(_[ALL](size(gte,3))));
+}
+
+BOOST_AUTO_TEST_CASE(CheckRecords)
+{
+    std::map<std::string,std::string> m1={{"field1","value1"},{"field2","value2"}};
+
+    auto v=validator(
+                _["field1"](size(gte,100)) ^OR^ _["field2"](gte,"z"),
+                _["field3"](exists,true)
+            );
+
+    structured_error_report err;
+    validate(m1,v,err);
+    BOOST_REQUIRE(err);
+    BOOST_CHECK_EQUAL(err.failure_count(),2);
+
+    std::vector<size_t> checks;
+    for (size_t i=0;i<err.records().size();i++)
+    {
+        if (err.records()[i].is_check())
+        {
+            checks.push_back(i);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(checks.size(),2);
+
+    const auto& rec1=err.records()[checks[0]];
+    BOOST_CHECK(rec1.kind==report_record_kind::member);
+    BOOST_CHECK(rec1.is_property(size));
+    BOOST_CHECK(rec1.is_operator(gte));
+    BOOST_CHECK(!rec1.is_operator(lt));
+    BOOST_CHECK(!rec1.negated);
+    BOOST_CHECK_EQUAL(rec1.depth,2);
+    BOOST_CHECK_EQUAL(err.member_name(checks[0]),"field1");
+
+    const auto& rec2=err.records()[checks[1]];
+    BOOST_CHECK(rec2.kind==report_record_kind::member);
+    BOOST_CHECK(rec2.is_property(value));
+    BOOST_CHECK_EQUAL(err.member_name(checks[1]),"field2");
+
+    BOOST_CHECK(err.records().front().kind==report_record_kind::aggregation_open);
+    BOOST_CHECK(err.records().front().aggregation==aggregation_id::AND);
+
+    BOOST_CHECK_EQUAL(err.message(),"size of field1 must be greater than or equal to 100 OR field2 must be greater than or equal to z");
+    // message is formatted once and then reused
+    BOOST_CHECK_EQUAL(err.message(),"size of field1 must be greater than or equal to 100 OR field2 must be greater than or equal to z");
+
+    m1["field2"]="zz";
+    validate(m1,v,err);
+    BOOST_REQUIRE(err);
+    BOOST_CHECK_EQUAL(err.failure_count(),1);
+    auto it=std::find_if(err.records().begin(),err.records().end(),[](const report_record& rec){return rec.is_check();});
+    BOOST_REQUIRE(it!=err.records().end());
+    BOOST_CHECK(it->kind==report_record_kind::member_exists);
+    BOOST_CHECK(it->is_operator(exists));
+    BOOST_CHECK_EQUAL(err.member_name(static_cast<size_t>(it-err.records().begin())),"field3");
+    BOOST_CHECK_EQUAL(err.message(),"field3 must exist");
+
+    m1["field3"]="value3";
+    validate(m1,v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK(err.records().empty());
+    BOOST_CHECK_EQUAL(err.failure_count(),0);
+    BOOST_CHECK(err.message().empty());
+}
+
+BOOST_AUTO_TEST_CASE(CheckPrevalidation)
+{
+    auto v=validator(
+                _["field1"](gte,100),
+                _["field2"](size(lt,3))
+            );
+
+    error_report err1;
+    validate(_["field1"],10,v,err1);
+    structured_error_report err2;
+    validate(_["field1"],10,v,err2);
+    BOOST_REQUIRE(err2);
+    BOOST_CHECK_EQUAL(err2.message(),err1.message());
+    BOOST_CHECK_EQUAL(err2.failure_count(),1);
+
+    validate(_["field1"],1000,v,err2);
+    BOOST_CHECK(!err2);
+    BOOST_CHECK(err2.message().empty());
+}
+
+BOOST_AUTO_TEST_CASE(CheckTemporaryValidator)
+{
+    std::map<std::string,std::map<std::string,std::map<std::string,size_t>>> m1={
+        {"a_very_long_key_exceeding_sso_buffer",{{"a_very_long_nested_key_exceeding_sso_buffer",{{"another_very_long_key_exceeding_sso_buffer",1}}}}}
+    };
+
+    // report must not refer to keys of validator destroyed after validation
+    structured_error_report err;
+    validate(m1,validator(_["a_very_long_key_exceeding_sso_buffer"][ALL][ALL](gte,10)),err);
+    BOOST_REQUIRE(err);
+    BOOST_CHECK_EQUAL(err.message(),"each element of each element of a_very_long_key_exceeding_sso_buffer must be greater than or equal to 10");
+
+    validate(m1,validator(_["a_very_long_key_exceeding_sso_buffer"]["a_very_long_nested_key_exceeding_sso_buffer"](size(gte,10))),err);
+    BOOST_REQUIRE(err);
+    BOOST_CHECK_EQUAL(err.failure_count(),1);
+    BOOST_CHECK_EQUAL(err.member_name(0),"a_very_long_nested_key_exceeding_sso_buffer of a_very_long_key_exceeding_sso_buffer");
+
+    std::map<std::string,size_t> m2={{"a_very_long_key_exceeding_sso_buffer",1},{"another_very_long_key_exceeding_sso_buffer",2}};
+    validate(m2,validator(_["a_very_long_key_exceeding_sso_buffer"](gt,_["another_very_long_key_exceeding_sso_buffer"])),err);
+    BOOST_REQUIRE(err);
+    BOOST_CHECK_EQUAL(err.message(),"a_very_long_key_exceeding_sso_buffer must be greater than another_very_long_key_exceeding_sso_buffer");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
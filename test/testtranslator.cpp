@@ -1,4 +1,6 @@
 #include <string>
+#include <thread>
+#include <atomic>
 #include <boost/test/unit_test.hpp>
 
 #include <dracosha/validator/reporting/translator.hpp>
@@ -209,6 +211,72 @@ BOOST_AUTO_TEST_CASE(CheckTranslatorRepository)
     BOOST_CHECK(tr2.get()==def_translator.get());
 }
 
+BOOST_AUTO_TEST_CASE(CheckTranslatorRepositoryCache)
+{
+    auto translator1=std::make_shared<mapped_translator>(std::map<std::string,std::string>{{"one","one_en"}});
+    auto translator2=std::make_shared<mapped_translator>(std::map<std::string,std::string>{{"one","one_de"}});
+    auto def_translator=std::make_shared<mapped_translator>(std::map<std::string,std::string>{{"one","one_def"}});
+
+    translator_repository rep(def_translator);
+    rep.add_translator(translator1,{"en_US","en"});
+    BOOST_CHECK_EQUAL(rep.cached_locale_count(),0);
+
+    BOOST_CHECK(rep.find_translator("en_US.UTF-8").get()==translator1.get());
+    BOOST_CHECK(rep.find_translator("en_US.UTF-8").get()==translator1.get());
+    BOOST_CHECK_EQUAL(rep.cached_locale_count(),1);
+
+    // fallback to default translator is cached too
+    BOOST_CHECK(&rep.get_translator("de_DE.UTF-8")==def_translator.get());
+    BOOST_CHECK_EQUAL(rep.cached_locale_count(),2);
+
+    // modifications of repository invalidate cache
+    rep.add_translator(translator2,{"de"});
+    BOOST_CHECK_EQUAL(rep.cached_locale_count(),0);
+    BOOST_CHECK(&rep.get_translator("de_DE.UTF-8")==translator2.get());
+    rep.set_default_translator(translator1);
+    BOOST_CHECK(&rep.get_translator("nl_BE")==translator1.get());
+    rep.set_default_translator(def_translator);
+    BOOST_CHECK(&rep.get_translator("nl_BE")==def_translator.get());
+
+    // copy does not share cache
+    auto rep1=rep;
+    BOOST_CHECK_EQUAL(rep1.cached_locale_count(),0);
+    BOOST_CHECK(&rep1.get_translator("de_DE.UTF-8")==translator2.get());
+
+    // number of cached names is limited
+    for (size_t i=0;i<translator_repository::max_cached_locales*2;i++)
+    {
+        BOOST_CHECK(&rep.get_translator(std::string("xx_")+std::to_string(i))==def_translator.get());
+    }
+    BOOST_CHECK_EQUAL(rep.cached_locale_count(),translator_repository::max_cached_locales);
+
+    // concurrent lookups
+    rep.clear();
+    std::vector<std::thread> threads;
+    std::atomic<size_t> mismatches{0};
+    for (size_t i=0;i<4;i++)
+    {
+        threads.emplace_back(
+            [&rep,&mismatches,&def_translator]()
+            {
+                for (size_t j=0;j<1000;j++)
+                {
+                    if (&rep.get_translator(std::string("de_")+std::to_string(j%16))!=def_translator.get())
+                    {
+                        ++mismatches;
+                    }
+                }
+            }
+        );
+    }
+    for (auto&& thread:threads)
+    {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(mismatches.load(),0);
+    BOOST_CHECK_EQUAL(rep.cached_locale_count(),16);
+}
+
 BOOST_AUTO_TEST_CASE(CheckConcretePhrase)
 {
     std::map<std::string,std::string> m=
@@ -1,11 +1,14 @@
 #include <memory>
+#include <stdexcept>
 
 #include <boost/test/unit_test.hpp>
 
 #include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/lazy.hpp>
 #include <dracosha/validator/aggregation/tree.hpp>
 #include <dracosha/validator/variadic_property.hpp>
 #include <dracosha/validator/adapters/reporting_adapter.hpp>
+#include <dracosha/validator/adapters/parallel_adapter.hpp>
 
 using namespace DRACOSHA_VALIDATOR_NAMESPACE;
 
@@ -51,6 +54,51 @@ DRACOSHA_VALIDATOR_PROPERTY(name)
 DRACOSHA_VALIDATOR_PROPERTY(child_count)
 DRACOSHA_VALIDATOR_VARIADIC_PROPERTY(child)
 
+struct ValueTreeNode
+{
+    ValueTreeNode child(size_t index) const
+    {
+        return ValueTreeNode{_children.at(index)};
+    }
+
+    size_t child_count() const
+    {
+        return _children.size();
+    }
+
+    std::string name() const
+    {
+        return _name;
+    }
+
+    std::string _name;
+    std::vector<ValueTreeNode> _children;
+};
+
+void fill_tree(TreeNode& node, size_t breadth, size_t depth)
+{
+    if (depth==0)
+    {
+        return;
+    }
+    for (size_t i=0;i<breadth;i++)
+    {
+        auto child=std::make_shared<TreeNode>(node.name()+"."+std::to_string(i));
+        fill_tree(*child,breadth,depth-1);
+        node.add_child(std::move(child));
+    }
+}
+
+TreeNode& last_leaf(TreeNode& node)
+{
+    auto* current=&node;
+    while (current->child_count()!=0)
+    {
+        current=current->mutable_child(current->child_count()-1).get();
+    }
+    return *current;
+}
+
 }
 
 BOOST_AUTO_TEST_CASE(CheckTreeAll)
@@ -226,4 +274,114 @@ BOOST_AUTO_TEST_CASE(CheckInvalidPath)
     BOOST_CHECK(v1.apply(s1));
 }
 
+BOOST_AUTO_TEST_CASE(CheckDeepTree)
+{
+    auto v1=validator(
+            _[tree(ALL,child,child_count)][name](gte,"Node")
+         );
+
+    // tree is traversed with explicit stack, thus depth of tree is not limited by call stack
+    const size_t depth=20000;
+    TreeNode tr1("Node 0");
+    auto* node=&tr1;
+    for (size_t i=0;i<depth;i++)
+    {
+        node->add_child(std::make_shared<TreeNode>("Node"));
+        node=node->mutable_child(0).get();
+    }
+    BOOST_CHECK(v1.apply(tr1));
+
+    node->add_child(std::make_shared<TreeNode>("0"));
+    BOOST_CHECK(!v1.apply(tr1));
+
+    // release deep tree without recursion
+    std::vector<std::shared_ptr<TreeNode>> nodes;
+    nodes.push_back(std::move(tr1._children.front()));
+    tr1._children.clear();
+    while (!nodes.back()->_children.empty())
+    {
+        auto next=std::move(nodes.back()->_children.front());
+        nodes.back()->_children.clear();
+        nodes.push_back(std::move(next));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CheckTreeChildByValue)
+{
+    auto v1=validator(
+            _[tree(ALL,child,child_count)][name](gte,"Node")
+         );
+    auto v2=validator(
+            _[tree(ANY,child,child_count)][name](lt,"Node")
+         );
+
+    ValueTreeNode tr1{"Node 0",{{"Node 0.0",{{"Node 0.0.0",{}},{"Node 0.0.1",{}}}},{"Node 0.1",{{"Node 0.1.0",{}}}}}};
+    BOOST_CHECK(v1.apply(tr1));
+    BOOST_CHECK(!v2.apply(tr1));
+
+    tr1._children[1]._children[0]._children.push_back(ValueTreeNode{"0.1.0.0",{}});
+    BOOST_CHECK(!v1.apply(tr1));
+    BOOST_CHECK(v2.apply(tr1));
+
+    thread_pool pool(2);
+    BOOST_CHECK(!v1.apply(make_parallel_adapter(tr1,pool)));
+    BOOST_CHECK(v2.apply(make_parallel_adapter(tr1,pool)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelTree)
+{
+    thread_pool pool(4);
+
+    auto v1=validator(
+            _[tree(ALL,child,child_count)][name](gte,"Node")
+         );
+    auto v2=validator(
+            _[tree(ANY,child,child_count)][name](lt,"Node")
+         );
+    auto v3=validator(
+            _["field1"][tree(ALL,child,child_count)][name](gte,"Node")
+         );
+
+    TreeNode tr1("Node 0");
+    fill_tree(tr1,4,6);
+
+    BOOST_CHECK(v1.apply(make_parallel_adapter(tr1,pool)));
+    BOOST_CHECK(!v2.apply(make_parallel_adapter(tr1,pool)));
+
+    std::map<std::string,TreeNode> m1{{"field1",tr1}};
+    BOOST_CHECK(v3.apply(make_parallel_adapter(m1,pool)));
+
+    // break the last visited node
+    auto& leaf=last_leaf(tr1);
+    leaf.add_child(std::make_shared<TreeNode>("0"));
+    BOOST_CHECK(!v1.apply(make_parallel_adapter(tr1,pool)));
+    BOOST_CHECK(!v1.apply(tr1));
+    BOOST_CHECK(v2.apply(make_parallel_adapter(tr1,pool)));
+    BOOST_CHECK(v2.apply(tr1));
+
+    // break only the top node
+    TreeNode tr2("0");
+    fill_tree(tr2,4,2);
+    BOOST_CHECK(!v1.apply(make_parallel_adapter(tr2,pool)));
+    BOOST_CHECK(v2.apply(make_parallel_adapter(tr2,pool)));
+
+    // tree without children
+    TreeNode tr3("Node 0");
+    BOOST_CHECK(v1.apply(make_parallel_adapter(tr3,pool)));
+    BOOST_CHECK(!v2.apply(make_parallel_adapter(tr3,pool)));
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelTreeException)
+{
+    thread_pool pool(4);
+
+    auto v1=validator(
+            _[tree(ALL,child,child_count)][name](gte,lazy([]() -> std::string {throw std::runtime_error("failed");}))
+         );
+
+    TreeNode tr1("Node 0");
+    fill_tree(tr1,4,3);
+    BOOST_CHECK_THROW(v1.apply(make_parallel_adapter(tr1,pool)),std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
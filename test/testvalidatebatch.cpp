@@ -0,0 +1,140 @@
+#include <map>
+#include <list>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/validate_batch.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestValidateBatch)
+
+BOOST_AUTO_TEST_CASE(CheckBatchSequential)
+{
+    auto v=validator(
+                _["field1"](gte,10),
+                _["field2"](lt,100)
+            );
+
+    std::vector<std::map<std::string,int>> objects(200,{{"field1",10},{"field2",20}});
+    objects[1]["field1"]=1;
+    objects[64]["field2"]=100;
+    objects[199]["field1"]=5;
+
+    batch_results results;
+    BOOST_CHECK(!validate_batch(objects.begin(),objects.end(),v,results));
+    BOOST_REQUIRE_EQUAL(results.size(),objects.size());
+    BOOST_CHECK_EQUAL(results.failed_count(),3);
+    BOOST_CHECK(!results.all_ok());
+    BOOST_CHECK_EQUAL(results.bitmap().size(),4);
+    for (size_t i=0;i<objects.size();i++)
+    {
+        bool expected=(i!=1 && i!=64 && i!=199);
+        BOOST_CHECK_EQUAL(results.ok(i),expected);
+        BOOST_CHECK_EQUAL(results[i],v.apply(objects[i]));
+        BOOST_CHECK(results.report(i).empty());
+    }
+
+    objects[1]["field1"]=10;
+    objects[64]["field2"]=10;
+    objects[199]["field1"]=10;
+    BOOST_CHECK(validate_batch(objects.begin(),objects.end(),v,results));
+    BOOST_CHECK(results.all_ok());
+
+    std::vector<std::map<std::string,int>> empty;
+    BOOST_CHECK(validate_batch(empty.begin(),empty.end(),v,results));
+    BOOST_CHECK_EQUAL(results.size(),0);
+}
+
+BOOST_AUTO_TEST_CASE(CheckBatchReports)
+{
+    auto v=validator(
+                _["field1"](gte,10)
+            );
+
+    std::list<std::map<std::string,int>> objects{
+        {{"field1",10}},
+        {{"field1",1}},
+        {{"field1",20},{"field2",1}}
+    };
+
+    batch_results results(true);
+    BOOST_CHECK(!validate_batch(objects.cbegin(),objects.cend(),v,results));
+    BOOST_CHECK(results.with_reports());
+    BOOST_CHECK(results.ok(0));
+    BOOST_CHECK(results.report(0).empty());
+    BOOST_CHECK(!results.ok(1));
+    BOOST_CHECK_EQUAL(results.report(1),"field1 must be greater than or equal to 10");
+    BOOST_CHECK(results.ok(2));
+}
+
+BOOST_AUTO_TEST_CASE(CheckBatchParallel)
+{
+    thread_pool pool(4);
+
+    auto v=validator(
+                _[ALL](gte,0)
+            );
+
+    std::vector<std::vector<int>> objects(10000,std::vector<int>(10,1));
+    objects[0][0]=-1;
+    objects[5000][9]=-1;
+    objects[9999][5]=-1;
+
+    batch_results results(true);
+    BOOST_CHECK(!validate_batch(objects.begin(),objects.end(),v,results,pool,100));
+    BOOST_REQUIRE_EQUAL(results.size(),objects.size());
+    BOOST_CHECK_EQUAL(results.failed_count(),3);
+    BOOST_CHECK(!results.ok(0));
+    BOOST_CHECK(!results.ok(5000));
+    BOOST_CHECK(!results.ok(9999));
+    BOOST_CHECK(results.ok(1));
+    BOOST_CHECK(results.ok(9998));
+    BOOST_CHECK_EQUAL(results.report(5000),"each element must be greater than or equal to 0");
+
+    batch_results sequential_results;
+    BOOST_CHECK(!validate_batch(objects.begin(),objects.end(),v,sequential_results));
+    BOOST_CHECK(sequential_results.bitmap()==results.bitmap());
+
+    objects[0][0]=1;
+    objects[5000][9]=1;
+    objects[9999][5]=1;
+    BOOST_CHECK(validate_batch(objects.begin(),objects.end(),v,results,pool,100));
+
+    // not random access iterators are processed sequentially
+    std::list<std::vector<int>> list_objects(1000,std::vector<int>(10,1));
+    list_objects.back()[0]=-1;
+    BOOST_CHECK(!validate_batch(list_objects.begin(),list_objects.end(),v,results,pool,100));
+    BOOST_CHECK_EQUAL(results.failed_count(),1);
+    BOOST_CHECK(!results.ok(999));
+}
+
+BOOST_AUTO_TEST_CASE(CheckRebindableAdapter)
+{
+    auto v=validator(
+                _["field1"](gte,10),
+                _["field2"](lt,100)
+            );
+
+    std::map<std::string,int> m1{{"field1",10},{"field2",20}};
+    std::map<std::string,int> m2{{"field1",10}};
+
+    auto a=make_rebindable_adapter(m1);
+    a.set_check_member_exists_before_validation(true);
+    a.set_unknown_member_mode(if_member_not_found::abort);
+    BOOST_CHECK(v.apply(a));
+
+    a.rebind(m2);
+    BOOST_CHECK(!v.apply(a));
+
+    auto a_copy=a;
+    BOOST_CHECK(a_copy.is_check_member_exists_before_validation());
+    BOOST_CHECK(!v.apply(a_copy));
+    a_copy.rebind(m1);
+    BOOST_CHECK(v.apply(a_copy));
+    BOOST_CHECK(!v.apply(a));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
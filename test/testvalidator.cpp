@@ -1,7 +1,9 @@
+#include <array>
 #include <set>
 #include <boost/test/unit_test.hpp>
 
 #include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/compile.hpp>
 
 using namespace DRACOSHA_VALIDATOR_NAMESPACE;
 
@@ -925,4 +927,121 @@ BOOST_AUTO_TEST_CASE(CheckSets)
     BOOST_CHECK(!v4.apply(s3));
 }
 
+BOOST_AUTO_TEST_CASE(CheckLazyMemoization)
+{
+    std::vector<size_t> vec1{10,20,30,40,50};
+
+    size_t calls=0;
+    size_t val1=10;
+    auto get_val=[&calls,&val1]()
+    {
+        ++calls;
+        return val1;
+    };
+
+    // memoized operand is evaluated once per validation pass
+    auto v1=validator(
+                _[ALL](gte,lazy(get_val))
+            );
+    BOOST_CHECK(v1.apply(vec1));
+    BOOST_CHECK_EQUAL(calls,1);
+
+    // operand is evaluated again in the next pass
+    val1=20;
+    BOOST_CHECK(!v1.apply(vec1));
+    BOOST_CHECK_EQUAL(calls,2);
+
+    // operand is evaluated for each element
+    calls=0;
+    auto v2=validator(
+                _[ALL](gte,lazy_each(get_val))
+            );
+    val1=10;
+    BOOST_CHECK(v2.apply(vec1));
+    BOOST_CHECK_EQUAL(calls,vec1.size());
+
+    // memoized operand referring to object
+    calls=0;
+    std::string str1("value");
+    auto get_ref=[&calls,&str1]() -> const std::string&
+    {
+        ++calls;
+        return str1;
+    };
+    std::vector<std::string> vec2{"value","value","value"};
+    auto v3=validator(
+                _[ALL](eq,lazy(get_ref))
+            );
+    BOOST_CHECK(v3.apply(vec2));
+    BOOST_CHECK_EQUAL(calls,1);
+    str1="other";
+    BOOST_CHECK(!v3.apply(vec2));
+    BOOST_CHECK_EQUAL(calls,2);
+
+    // memoized operand used out of validation pass
+    auto l1=lazy(get_val);
+    calls=0;
+    BOOST_CHECK_EQUAL(l1(),10);
+    BOOST_CHECK_EQUAL(l1(),10);
+    BOOST_CHECK_EQUAL(calls,2);
+}
+
+BOOST_AUTO_TEST_CASE(CheckLazyMemoizationCopiesAndCompiled)
+{
+    std::vector<size_t> vec1{10,20,30,40,50};
+
+    size_t calls=0;
+    auto get_val=[&calls]()
+    {
+        ++calls;
+        return size_t(10);
+    };
+
+    // copies of memoized operand share the result
+    auto l1=lazy(get_val);
+    auto v1=validator(
+                _[ALL](gte,l1),
+                _[ALL](lte,l1) ^OR^ _[ANY](gte,50)
+            );
+    BOOST_CHECK(v1.apply(vec1));
+    BOOST_CHECK_EQUAL(calls,1);
+
+    // compiled validator opens validation pass
+    calls=0;
+    auto v2=compile(validator(
+                _[0](gte,lazy(get_val)),
+                _[1](gte,lazy(get_val)),
+                _[2](gte,l1),
+                _[3](gte,l1)
+            ));
+    BOOST_CHECK(v2.apply(vec1));
+    BOOST_CHECK_EQUAL(calls,3);
+
+    // more results than inline slots and values larger than inline buffers
+    calls=0;
+    using big_type=std::array<size_t,8>;
+    auto get_big=[&calls]()
+    {
+        ++calls;
+        return big_type{{10}};
+    };
+    auto first=[](const auto& arr){return arr[0];};
+    std::vector<decltype(lazy(get_val))> lazies;
+    for (size_t i=0;i<20;i++)
+    {
+        lazies.push_back(lazy(get_val));
+    }
+    auto l2=lazy(get_big);
+    detail::lazy_pass_scope scope;
+    for (size_t j=0;j<2;j++)
+    {
+        for (auto&& l:lazies)
+        {
+            BOOST_CHECK_EQUAL(l(),10);
+        }
+        BOOST_CHECK_EQUAL(first(l2()),10);
+    }
+    BOOST_CHECK_EQUAL(calls,21);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
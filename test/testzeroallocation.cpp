@@ -0,0 +1,247 @@
+#include <cstdlib>
+#include <new>
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <dracosha/validator/validator.hpp>
+#include <dracosha/validator/validate.hpp>
+#include <dracosha/validator/property.hpp>
+#include <dracosha/validator/operators/in.hpp>
+#include <dracosha/validator/operators/lex_in.hpp>
+#include <dracosha/validator/operators/string_patterns.hpp>
+#include <dracosha/validator/operators/number_patterns.hpp>
+#include <dracosha/validator/interval.hpp>
+
+using namespace DRACOSHA_VALIDATOR_NAMESPACE;
+
+namespace {
+
+thread_local bool CountAllocations=false;
+thread_local size_t AllocationsCount=0;
+
+/**
+ * @brief Count heap allocations made by the current thread while invoking a function.
+ */
+template <typename FnT>
+size_t countAllocations(FnT&& fn, bool& result)
+{
+    AllocationsCount=0;
+    CountAllocations=true;
+    result=fn();
+    CountAllocations=false;
+    return AllocationsCount;
+}
+
+struct ZeroAllocFoo
+{
+    std::string var1;
+
+    uint32_t get_var2() const
+    {
+        return _var2;
+    }
+
+    private:
+
+        uint32_t _var2=1000;
+};
+
+DRACOSHA_VALIDATOR_PROPERTY(var1)
+DRACOSHA_VALIDATOR_PROPERTY(get_var2)
+
+// keys and values that do not fit into small string buffer
+const char* LongKey1="a_very_long_field_name_exceeding_sso_1";
+const char* LongKey2="a_very_long_field_name_exceeding_sso_2";
+const char* LongKey3="a_very_long_field_name_exceeding_sso_3";
+const char* LongValue="a_very_long_value_exceeding_sso_value";
+
+}
+
+void* operator new(size_t size)
+{
+    if (CountAllocations)
+    {
+        ++AllocationsCount;
+    }
+    auto p=std::malloc(size==0?1:size);
+    if (p==nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+#define CHECK_NO_ALLOCATIONS(expected,expr) \
+    { \
+        bool result=false; \
+        auto count=countAllocations([&](){return static_cast<bool>(expr);},result); \
+        BOOST_CHECK_EQUAL(count,0u); \
+        BOOST_CHECK_EQUAL(result,expected); \
+    }
+
+BOOST_AUTO_TEST_SUITE(TestZeroAllocation)
+
+BOOST_AUTO_TEST_CASE(CheckExamples)
+{
+    // example 1
+    auto v1=validator(gt,100);
+    error err;
+    CHECK_NO_ALLOCATIONS(true,(validate(90,v1,err),err));
+    CHECK_NO_ALLOCATIONS(false,(validate(200,v1,err),err));
+
+    // example 4
+    int value1=200;
+    auto a1=make_default_adapter(value1);
+    CHECK_NO_ALLOCATIONS(true,v1.apply(a1));
+    CHECK_NO_ALLOCATIONS(true,v1.apply(value1));
+    int value2=90;
+    CHECK_NO_ALLOCATIONS(false,v1.apply(value2));
+
+    // example 6
+    auto validator_of_sets=validator(
+        _["level2"](exists,true)
+    );
+    auto validator_of_maps_of_sets=validator(
+        _["level1"](validator_of_sets)
+    );
+    std::map<std::string,std::set<std::string>> map_of_sets1{
+        {"level1",{"level2"}}
+    };
+    CHECK_NO_ALLOCATIONS(true,validator_of_maps_of_sets.apply(map_of_sets1));
+    std::map<std::string,std::set<std::string>> map_of_sets2{
+        {"level1",{"level2_1"}}
+    };
+    CHECK_NO_ALLOCATIONS(false,validator_of_maps_of_sets.apply(map_of_sets2));
+
+    // example 7 with default adapter
+    auto v7=validator(
+                _["field1"][1](in,range({10,20,30,40,50})),
+                _["field1"][2](lt,100),
+                _["field2"](exists,false),
+                _["field3"](empty(flag,true))
+            );
+    std::map<std::string,std::map<size_t,size_t>> nested_map={
+                {"field1",{{1,5},{2,50}}},
+                {"field3",{}}
+            };
+    CHECK_NO_ALLOCATIONS(false,v7.apply(nested_map));
+    nested_map["field1"][1]=10;
+    CHECK_NO_ALLOCATIONS(true,v7.apply(nested_map));
+
+    // example 8
+    std::map<std::string,int> m8={
+            {"field1",10},
+            {"field3",100}
+        };
+    auto a8=make_default_adapter(m8);
+    a8.set_check_member_exists_before_validation(true);
+    a8.set_unknown_member_mode(if_member_not_found::abort);
+    auto v8=validator(
+                _["field1"](gte,9),
+                _["field3"](eq,100)
+            );
+    CHECK_NO_ALLOCATIONS(true,v8.apply(a8));
+    auto v8_1=validator(
+                _["field1"](eq,10),
+                _["field2"](lt,1000)
+            );
+    CHECK_NO_ALLOCATIONS(false,v8_1.apply(a8));
+
+    // example 9
+    auto v9=validator(
+        var1(ne,"unknown"),
+        get_var2(gte,100)
+    );
+    ZeroAllocFoo foo;
+    CHECK_NO_ALLOCATIONS(true,v9.apply(foo));
+    foo.var1="unknown";
+    CHECK_NO_ALLOCATIONS(false,v9.apply(foo));
+}
+
+BOOST_AUTO_TEST_CASE(CheckLongKeys)
+{
+    std::map<std::string,std::map<std::string,std::map<std::string,std::string>>> m1{
+        {LongKey1,{{LongKey2,{{LongKey3,LongValue}}}}}
+    };
+
+    auto v1=validator(_[LongKey1][LongKey2][LongKey3](gte,"a"));
+    CHECK_NO_ALLOCATIONS(true,v1.apply(m1));
+
+    auto v2=validator(_[LongKey1][LongKey2][LongKey3](eq,_[LongKey1][LongKey2][LongKey3]));
+    CHECK_NO_ALLOCATIONS(true,v2.apply(m1));
+
+    auto v3=validator(
+                _[LongKey1](exists,true),
+                _[LongKey2](exists,false),
+                _[LongKey1][LongKey2](size(gte,1))
+            );
+    CHECK_NO_ALLOCATIONS(true,v3.apply(m1));
+
+    auto v4=validator(_[LongKey1][LongKey2][LongKey3](str_int,false));
+    CHECK_NO_ALLOCATIONS(true,v4.apply(m1));
+
+    auto v5=validator(_[LongKey1][LongKey2][LongKey3](value(lt,"z") ^OR^ value(eq,"")));
+    CHECK_NO_ALLOCATIONS(true,v5.apply(m1));
+
+    auto v6=validator(_[LongKey1][LongKey2][LongKey3](in,interval("a","b")));
+    CHECK_NO_ALLOCATIONS(true,v6.apply(m1));
+
+    error err;
+    CHECK_NO_ALLOCATIONS(false,(validate(m1,v1,err),err));
+}
+
+BOOST_AUTO_TEST_CASE(CheckAggregations)
+{
+    std::map<std::string,std::map<std::string,std::map<std::string,std::string>>> m1{
+        {LongKey1,{{LongKey2,{{LongKey3,LongValue}}}}}
+    };
+
+    auto v1=validator(_[LongKey1][ALL][ALL](size(gte,1)));
+    CHECK_NO_ALLOCATIONS(true,v1.apply(m1));
+
+    auto v2=validator(_[LongKey1][ANY][LongKey3](lex_in,range({"x",LongValue})));
+    CHECK_NO_ALLOCATIONS(true,v2.apply(m1));
+
+    auto v3=validator(_[LongKey1][ALL][LongKey3](NOT(value(eq,"x"))));
+    CHECK_NO_ALLOCATIONS(true,v3.apply(m1));
+
+    std::vector<std::string> vec{LongValue,LongValue,LongValue};
+    auto v4=validator(_[ALL](size(gte,10)));
+    CHECK_NO_ALLOCATIONS(true,v4.apply(vec));
+    auto v5=validator(_[ANY](eq,"x"));
+    CHECK_NO_ALLOCATIONS(false,v5.apply(vec));
+}
+
+BOOST_AUTO_TEST_CASE(CheckNestedValidators)
+{
+    std::map<std::string,std::map<std::string,std::map<std::string,std::string>>> m1{
+        {LongKey1,{{LongKey2,{{LongKey3,LongValue}}}}}
+    };
+
+    auto v1=validator(
+        _[LongKey3](size(gte,1))
+    );
+    auto v2=validator(
+        _[LongKey1][LongKey2](v1)
+    );
+    CHECK_NO_ALLOCATIONS(true,v2.apply(m1));
+
+    m1[LongKey1][LongKey2][LongKey3].clear();
+    CHECK_NO_ALLOCATIONS(false,v2.apply(m1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()